@@ -3,7 +3,9 @@
 #include <algorithm>
 #include <cstdint>
 #include <random>
+#include <span>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include <boundcraft/boundcraft.hpp>
@@ -99,6 +101,58 @@ static void run_bench(benchmark::State& state, QueryPattern pat, LB&& lb) {
     state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
 }
 
+template <class Policy>
+static void run_batch_bench(benchmark::State& state, QueryPattern pat) {
+    const std::size_t n = static_cast<std::size_t>(state.range(0));
+    auto data = make_sorted_unique(n);
+
+    std::mt19937 rng(123456u);
+    std::vector<int> queries;
+    queries.resize(4096);
+    for (auto& q : queries) q = make_query(rng, data, pat);
+
+    boundcraft::searcher<Policy> s;
+    std::vector<const int*> out(queries.size());
+    std::size_t sink = 0;
+
+    for (auto _ : state) {
+        s.lower_bound_batch(std::span<const int>(data), std::span<const int>(queries), std::span<const int*>(out));
+
+        sink += static_cast<std::size_t>(out.back() - data.data());
+        benchmark::DoNotOptimize(sink);
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * queries.size()));
+}
+
+// Layout indexes are built once from the sorted data and report positions.
+template <class Index, class Search>
+static void run_index_bench(benchmark::State& state, QueryPattern pat, Search&& search) {
+    const std::size_t n = static_cast<std::size_t>(state.range(0));
+    auto data = make_sorted_unique(n);
+    const Index index{std::span<const int>(data)};
+
+    std::mt19937 rng(123456u);
+    std::vector<int> queries;
+    queries.resize(4096);
+    for (auto& q : queries) q = make_query(rng, data, pat);
+
+    std::size_t qi = 0;
+    std::size_t sink = 0;
+
+    for (auto _ : state) {
+        const int key = queries[qi++ & (queries.size() - 1)];
+
+        sink += static_cast<std::size_t>(search(index, key));
+
+        benchmark::DoNotOptimize(sink);
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+
 } // namespace
 
 // std::lower_bound
@@ -175,6 +229,42 @@ static void BM_bc_standard_back(benchmark::State& state) {
              });
 }
 
+// prefetch_binary: both next midpoints (one level) or all six two levels ahead
+static void BM_bc_prefetch1_uniform(benchmark::State& state) {
+    using Policy = boundcraft::policy::prefetch_binary<1>;
+    boundcraft::searcher<Policy> s;
+    run_bench(state, QueryPattern::UniformRandom,
+             [&](const std::vector<int>& data, int key) {
+                 return s.lower_bound(data.begin(), data.end(), key);
+             });
+}
+static void BM_bc_prefetch2_uniform(benchmark::State& state) {
+    using Policy = boundcraft::policy::prefetch_binary<2>;
+    boundcraft::searcher<Policy> s;
+    run_bench(state, QueryPattern::UniformRandom,
+             [&](const std::vector<int>& data, int key) {
+                 return s.lower_bound(data.begin(), data.end(), key);
+             });
+}
+
+// branchless
+static void BM_bc_branchless_uniform(benchmark::State& state) {
+    using Policy = boundcraft::policy::branchless;
+    boundcraft::searcher<Policy> s;
+    run_bench(state, QueryPattern::UniformRandom,
+             [&](const std::vector<int>& data, int key) {
+                 return s.lower_bound(data.begin(), data.end(), key);
+             });
+}
+static void BM_bc_branchless_misses(benchmark::State& state) {
+    using Policy = boundcraft::policy::branchless;
+    boundcraft::searcher<Policy> s;
+    run_bench(state, QueryPattern::MostlyMisses,
+             [&](const std::vector<int>& data, int key) {
+                 return s.lower_bound(data.begin(), data.end(), key);
+             });
+}
+
 // hybrids
 static void BM_bc_hybrid16_uniform(benchmark::State& state) {
     using Policy = boundcraft::policy::hybrid<16>;
@@ -194,6 +284,43 @@ static void BM_bc_hybrid64_uniform(benchmark::State& state) {
              });
 }
 
+// calibrated per-length kernel choice (calibration runs before timing)
+static void BM_bc_hybrid_auto_uniform(benchmark::State& state) {
+    using Policy = boundcraft::policy::hybrid_auto;
+    boundcraft::searcher<Policy> s;
+    run_bench(state, QueryPattern::UniformRandom,
+             [&](const std::vector<int>& data, int key) {
+                 return s.lower_bound(data.begin(), data.end(), key);
+             });
+}
+
+static void BM_bc_adaptive_uniform(benchmark::State& state) {
+    boundcraft::adaptive_warm_up<int>();
+    boundcraft::searcher<boundcraft::policy::adaptive> s;
+    run_bench(state, QueryPattern::UniformRandom,
+             [&](const std::vector<int>& data, int key) {
+                 return s.lower_bound(data.begin(), data.end(), key);
+             });
+}
+
+// interpolation
+static void BM_bc_interpolation_uniform(benchmark::State& state) {
+    using Policy = boundcraft::policy::interpolation<>;
+    boundcraft::searcher<Policy> s;
+    run_bench(state, QueryPattern::UniformRandom,
+             [&](const std::vector<int>& data, int key) {
+                 return s.lower_bound(data.begin(), data.end(), key);
+             });
+}
+static void BM_bc_interpolation_misses(benchmark::State& state) {
+    using Policy = boundcraft::policy::interpolation<>;
+    boundcraft::searcher<Policy> s;
+    run_bench(state, QueryPattern::MostlyMisses,
+             [&](const std::vector<int>& data, int key) {
+                 return s.lower_bound(data.begin(), data.end(), key);
+             });
+}
+
 // galloping examples (update types if your policy names differ)
 static void BM_bc_gallop_std_front_uniform(benchmark::State& state) {
     using Policy = boundcraft::policy::galloping<
@@ -219,6 +346,331 @@ static void BM_bc_gallop_hybrid16_front_uniform(benchmark::State& state) {
              });
 }
 
+// batched lookups (lockstep probing + prefetch)
+static void BM_bc_standard_batch_uniform(benchmark::State& state) {
+    run_batch_bench<boundcraft::policy::standard_binary>(state, QueryPattern::UniformRandom);
+}
+static void BM_bc_branchless_batch_uniform(benchmark::State& state) {
+    run_batch_bench<boundcraft::policy::branchless>(state, QueryPattern::UniformRandom);
+}
+
+// parallel batch over a shared pool (1M keys per iteration)
+static void BM_bc_parallel_batch_uniform(benchmark::State& state) {
+    const std::size_t n = static_cast<std::size_t>(state.range(0));
+    auto data = make_sorted_unique(n);
+
+    std::mt19937 rng(123456u);
+    std::vector<int> queries(1 << 20);
+    for (auto& q : queries) q = make_query(rng, data, QueryPattern::UniformRandom);
+
+    static boundcraft::thread_pool pool;
+    std::vector<const int*> out(queries.size());
+    const int* first = data.data();
+    std::size_t sink = 0;
+
+    for (auto _ : state) {
+        boundcraft::parallel_lower_bound_batch<boundcraft::policy::branchless>(
+            pool, first, first + data.size(), std::span<const int>(queries), std::span<const int*>(out));
+
+        sink += static_cast<std::size_t>(out.back() - first);
+        benchmark::DoNotOptimize(sink);
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * queries.size()));
+}
+
+// pairwise intersection: 1024 keys against a list of state.range(0) keys
+static void run_intersect_bench(benchmark::State& state, bool use_std) {
+    const std::size_t n = static_cast<std::size_t>(state.range(0));
+    auto large = make_sorted_unique(n);
+
+    std::mt19937 rng(123456u);
+    std::vector<int> small(1024);
+    for (auto& q : small) q = make_query(rng, large, QueryPattern::UniformRandom);
+    std::sort(small.begin(), small.end());
+
+    std::vector<int> out(small.size());
+    std::size_t sink = 0;
+
+    for (auto _ : state) {
+        if (use_std) {
+            sink += static_cast<std::size_t>(std::set_intersection(small.begin(), small.end(), large.begin(), large.end(), out.begin()) - out.begin());
+        } else {
+            sink += boundcraft::intersect(std::span<const int>(small), std::span<const int>(large), std::span<int>(out));
+        }
+        benchmark::DoNotOptimize(sink);
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * small.size()));
+}
+static void BM_std_set_intersection(benchmark::State& state) { run_intersect_bench(state, true); }
+static void BM_bc_intersect(benchmark::State& state) { run_intersect_bench(state, false); }
+
+// 8-way intersection: one short list and seven of state.range(0) keys
+static void run_intersect_k_bench(benchmark::State& state, bool pairwise) {
+    const std::size_t n = static_cast<std::size_t>(state.range(0));
+    std::mt19937 rng(123456u);
+    std::uniform_int_distribution<int> dist(0, static_cast<int>(4 * n));
+
+    std::vector<std::vector<int>> lists(8);
+    for (std::size_t i = 0; i < lists.size(); ++i) {
+        lists[i].resize(i == 0 ? 256 : n);
+        for (auto& x : lists[i]) x = dist(rng);
+        std::sort(lists[i].begin(), lists[i].end());
+    }
+    std::vector<std::span<const int>> spans(lists.begin(), lists.end());
+    std::vector<int> out(n), tmp(n);
+    std::size_t sink = 0;
+
+    for (auto _ : state) {
+        if (pairwise) {
+            std::size_t m = boundcraft::intersect(spans[0], spans[1], std::span<int>(out));
+            for (std::size_t i = 2; i < spans.size(); ++i) {
+                m = boundcraft::intersect(std::span<const int>(out.data(), m), spans[i], std::span<int>(tmp));
+                std::swap(out, tmp);
+            }
+            sink += m;
+        } else {
+            sink += boundcraft::intersect_k(std::span<const std::span<const int>>(spans), std::span<int>(out));
+        }
+        benchmark::DoNotOptimize(sink);
+        benchmark::ClobberMemory();
+    }
+}
+static void BM_bc_intersect_pairwise_chain(benchmark::State& state) { run_intersect_k_bench(state, true); }
+static void BM_bc_intersect_k(benchmark::State& state) { run_intersect_k_bench(state, false); }
+
+// eytzinger layout
+static void BM_bc_eytzinger_uniform(benchmark::State& state) {
+    boundcraft::searcher<boundcraft::policy::eytzinger<>> s;
+    run_index_bench<boundcraft::eytzinger_index<int>>(state, QueryPattern::UniformRandom,
+             [&](const boundcraft::eytzinger_index<int>& idx, int key) {
+                 return s.lower_bound(idx, key);
+             });
+}
+static void BM_bc_eytzinger_misses(benchmark::State& state) {
+    boundcraft::searcher<boundcraft::policy::eytzinger<>> s;
+    run_index_bench<boundcraft::eytzinger_index<int>>(state, QueryPattern::MostlyMisses,
+             [&](const boundcraft::eytzinger_index<int>& idx, int key) {
+                 return s.lower_bound(idx, key);
+             });
+}
+
+// static B+-tree (S-tree)
+static void BM_bc_s_tree_uniform(benchmark::State& state) {
+    run_index_bench<boundcraft::s_tree<int>>(state, QueryPattern::UniformRandom,
+             [](const boundcraft::s_tree<int>& tree, int key) {
+                 return tree.lower_bound(key) - tree.begin();
+             });
+}
+static void BM_bc_s_tree_misses(benchmark::State& state) {
+    run_index_bench<boundcraft::s_tree<int>>(state, QueryPattern::MostlyMisses,
+             [](const boundcraft::s_tree<int>& tree, int key) {
+                 return tree.lower_bound(key) - tree.begin();
+             });
+}
+
+// learned piecewise-linear index
+static void BM_bc_pgm_uniform(benchmark::State& state) {
+    run_index_bench<boundcraft::pgm_index<int>>(state, QueryPattern::UniformRandom,
+             [](const boundcraft::pgm_index<int>& idx, int key) {
+                 return idx.lower_bound(key) - idx.begin();
+             });
+}
+static void BM_bc_pgm_misses(benchmark::State& state) {
+    run_index_bench<boundcraft::pgm_index<int>>(state, QueryPattern::MostlyMisses,
+             [](const boundcraft::pgm_index<int>& idx, int key) {
+                 return idx.lower_bound(key) - idx.begin();
+             });
+}
+
+// radix prefix hint table
+static void BM_bc_radix_hint_uniform(benchmark::State& state) {
+    run_index_bench<boundcraft::radix_hint_index<int>>(state, QueryPattern::UniformRandom,
+             [](const boundcraft::radix_hint_index<int>& idx, int key) {
+                 return idx.lower_bound(key) - idx.begin();
+             });
+}
+static void BM_bc_radix_hint_misses(benchmark::State& state) {
+    run_index_bench<boundcraft::radix_hint_index<int>>(state, QueryPattern::MostlyMisses,
+             [](const boundcraft::radix_hint_index<int>& idx, int key) {
+                 return idx.lower_bound(key) - idx.begin();
+             });
+}
+
+// page fence pointers (4 KiB pages)
+static void BM_bc_fence_uniform(benchmark::State& state) {
+    run_index_bench<boundcraft::fence_index<int>>(state, QueryPattern::UniformRandom,
+             [](const boundcraft::fence_index<int>& idx, int key) {
+                 return idx.lower_bound(key) - idx.begin();
+             });
+}
+
+// summary of every k-th key (32 KiB), then one k-wide slice
+static void BM_bc_summary_uniform(benchmark::State& state) {
+    run_index_bench<boundcraft::summary_index<int>>(state, QueryPattern::UniformRandom,
+             [](const boundcraft::summary_index<int>& idx, int key) {
+                 return idx.lower_bound(key) - idx.begin();
+             });
+}
+
+// Compressed containers own a uint32 copy of the keys and return positions.
+template <class Index>
+static void run_compressed_bench(benchmark::State& state, QueryPattern pat) {
+    const std::size_t n = static_cast<std::size_t>(state.range(0));
+    auto data = make_sorted_unique(n);
+    const std::vector<std::uint32_t> keys(data.begin(), data.end());
+    const Index index{std::span<const std::uint32_t>(keys)};
+
+    std::mt19937 rng(123456u);
+    std::vector<std::uint32_t> queries(4096);
+    for (auto& q : queries) q = static_cast<std::uint32_t>(make_query(rng, data, pat));
+
+    std::size_t qi = 0;
+    std::size_t sink = 0;
+
+    for (auto _ : state) {
+        sink += index.lower_bound(queries[qi++ & (queries.size() - 1)]);
+
+        benchmark::DoNotOptimize(sink);
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+    state.counters["bytes_per_key"] = static_cast<double>(index.memory_bytes()) / static_cast<double>(n);
+}
+
+// frame-of-reference + bit-packed blocks of 128
+static void BM_bc_compressed_uniform(benchmark::State& state) {
+    run_compressed_bench<boundcraft::compressed_array<std::uint32_t>>(state, QueryPattern::UniformRandom);
+}
+
+// Elias-Fano (compare with BM_bc_standard_* at the same n)
+static void BM_bc_elias_fano_uniform(benchmark::State& state) {
+    run_compressed_bench<boundcraft::elias_fano<std::uint32_t>>(state, QueryPattern::UniformRandom);
+}
+static void BM_bc_elias_fano_misses(benchmark::State& state) {
+    run_compressed_bench<boundcraft::elias_fano<std::uint32_t>>(state, QueryPattern::MostlyMisses);
+}
+static void BM_bc_elias_fano_front(benchmark::State& state) {
+    run_compressed_bench<boundcraft::elias_fano<std::uint32_t>>(state, QueryPattern::NearFront);
+}
+
+// one copy per NUMA node (a single copy unless built with BOUNDCRAFT_WITH_NUMA on a NUMA host)
+static void BM_bc_replicated_uniform(benchmark::State& state) {
+    run_compressed_bench<boundcraft::replicated_index<std::uint32_t>>(state, QueryPattern::UniformRandom);
+}
+
+// URL-like string keys: one scheme, many hosts, random paths.
+static std::vector<std::string> make_sorted_urls(std::size_t n) {
+    std::mt19937 rng(42u);
+    std::uniform_int_distribution<int> ch('a', 'z');
+    std::vector<std::string> v(n);
+    for (auto& s : v) {
+        s = "https://www.";
+        for (int i = 0; i < 8; ++i) s.push_back(static_cast<char>(ch(rng)));
+        s += ".com/";
+        for (int i = 0; i < 16; ++i) s.push_back(static_cast<char>(ch(rng)));
+    }
+    std::sort(v.begin(), v.end());
+    return v;
+}
+
+template <class Search>
+static void run_string_bench(benchmark::State& state, Search&& search) {
+    const std::size_t n = static_cast<std::size_t>(state.range(0));
+    const auto data = make_sorted_urls(n);
+
+    std::mt19937 rng(123456u);
+    std::uniform_int_distribution<std::size_t> idx(0, n - 1);
+    std::vector<std::string> queries(4096);
+    for (auto& q : queries) q = data[idx(rng)];
+
+    std::size_t qi = 0;
+    std::size_t sink = 0;
+
+    for (auto _ : state) {
+        sink += static_cast<std::size_t>(search(data, std::string_view(queries[qi++ & (queries.size() - 1)])));
+
+        benchmark::DoNotOptimize(sink);
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+
+static void BM_bc_standard_strings(benchmark::State& state) {
+    boundcraft::searcher<boundcraft::policy::standard_binary> s;
+    run_string_bench(state, [&](const std::vector<std::string>& v, std::string_view key) {
+        return s.lower_bound(v.begin(), v.end(), key, std::less<>{}) - v.begin();
+    });
+}
+
+// normalized 8-byte prefixes, full compare only on prefix ties
+static void BM_bc_string_index(benchmark::State& state) {
+    const std::vector<std::string>* source = nullptr;
+    boundcraft::string_index<> index;
+    run_string_bench(state, [&](const std::vector<std::string>& v, std::string_view key) {
+        if (source != &v) {
+            index = boundcraft::string_index<>{std::span<const std::string>(v)};
+            source = &v;
+        }
+        return index.lower_bound(key) - index.begin();
+    });
+}
+
+// 64-byte records searched by their key member
+struct bench_record {
+    int key;
+    char payload[60];
+};
+
+// make_search(records) builds whatever it needs up front and returns the per-key search.
+template <class Make_Search>
+static void run_record_bench(benchmark::State& state, Make_Search&& make_search) {
+    const std::size_t n = static_cast<std::size_t>(state.range(0));
+    auto data = make_sorted_unique(n);
+    std::vector<bench_record> records(n);
+    for (std::size_t i = 0; i < n; ++i) records[i].key = data[i];
+    auto search = make_search(std::span<const bench_record>(records));
+
+    std::mt19937 rng(123456u);
+    std::vector<int> queries(4096);
+    for (auto& q : queries) q = make_query(rng, data, QueryPattern::UniformRandom);
+
+    std::size_t qi = 0;
+    std::size_t sink = 0;
+
+    for (auto _ : state) {
+        sink += static_cast<std::size_t>(search(queries[qi++ & (queries.size() - 1)]));
+
+        benchmark::DoNotOptimize(sink);
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+
+static void BM_bc_hybrid16_records(benchmark::State& state) {
+    run_record_bench(state, [](std::span<const bench_record> v) {
+        return [v](int key) {
+            boundcraft::searcher<boundcraft::policy::hybrid<16>> s;
+            return s.lower_bound(v.begin(), v.end(), key, [](const bench_record& r, int k) { return r.key < k; }) - v.begin();
+        };
+    });
+}
+
+// dense key column side index
+static void BM_bc_key_column_records(benchmark::State& state) {
+    run_record_bench(state, [](std::span<const bench_record> v) {
+        return [index = boundcraft::key_column_index<bench_record, int bench_record::*>(v, &bench_record::key)](int key) {
+            return index.lower_bound(key) - index.begin();
+        };
+    });
+}
+
 BENCHMARK(BM_std_lower_bound_uniform)->Arg(1<<10)->Arg(1<<14)->Arg(1<<18)->Arg(1<<22);
 BENCHMARK(BM_std_lower_bound_hits)   ->Arg(1<<10)->Arg(1<<14)->Arg(1<<18)->Arg(1<<22);
 BENCHMARK(BM_std_lower_bound_misses) ->Arg(1<<10)->Arg(1<<14)->Arg(1<<18)->Arg(1<<22);
@@ -231,10 +683,58 @@ BENCHMARK(BM_bc_standard_misses) ->Arg(1<<10)->Arg(1<<14)->Arg(1<<18)->Arg(1<<22
 BENCHMARK(BM_bc_standard_front)  ->Arg(1<<10)->Arg(1<<14)->Arg(1<<18)->Arg(1<<22);
 BENCHMARK(BM_bc_standard_back)   ->Arg(1<<10)->Arg(1<<14)->Arg(1<<18)->Arg(1<<22);
 
+BENCHMARK(BM_bc_prefetch1_uniform)->Arg(1<<10)->Arg(1<<14)->Arg(1<<18)->Arg(1<<22);
+BENCHMARK(BM_bc_prefetch2_uniform)->Arg(1<<10)->Arg(1<<14)->Arg(1<<18)->Arg(1<<22);
+
+BENCHMARK(BM_bc_branchless_uniform)->Arg(1<<10)->Arg(1<<14)->Arg(1<<18)->Arg(1<<22);
+BENCHMARK(BM_bc_branchless_misses) ->Arg(1<<10)->Arg(1<<14)->Arg(1<<18)->Arg(1<<22);
+
 BENCHMARK(BM_bc_hybrid16_uniform)->Arg(1<<10)->Arg(1<<14)->Arg(1<<18)->Arg(1<<22);
 BENCHMARK(BM_bc_hybrid64_uniform)->Arg(1<<10)->Arg(1<<14)->Arg(1<<18)->Arg(1<<22);
+BENCHMARK(BM_bc_hybrid_auto_uniform)->Arg(1<<10)->Arg(1<<14)->Arg(1<<18)->Arg(1<<22);
+BENCHMARK(BM_bc_adaptive_uniform)->Arg(1<<10)->Arg(1<<14)->Arg(1<<18)->Arg(1<<22);
+
+BENCHMARK(BM_bc_interpolation_uniform)->Arg(1<<10)->Arg(1<<14)->Arg(1<<18)->Arg(1<<22);
+BENCHMARK(BM_bc_interpolation_misses) ->Arg(1<<10)->Arg(1<<14)->Arg(1<<18)->Arg(1<<22);
 
 BENCHMARK(BM_bc_gallop_std_front_uniform)->Arg(1<<10)->Arg(1<<14)->Arg(1<<18)->Arg(1<<22);
 BENCHMARK(BM_bc_gallop_hybrid16_front_uniform)->Arg(1<<10)->Arg(1<<14)->Arg(1<<18)->Arg(1<<22);
 
+BENCHMARK(BM_bc_eytzinger_uniform)->Arg(1<<10)->Arg(1<<14)->Arg(1<<18)->Arg(1<<22);
+BENCHMARK(BM_bc_eytzinger_misses) ->Arg(1<<10)->Arg(1<<14)->Arg(1<<18)->Arg(1<<22);
+
+BENCHMARK(BM_bc_s_tree_uniform)->Arg(1<<10)->Arg(1<<14)->Arg(1<<18)->Arg(1<<22);
+BENCHMARK(BM_bc_s_tree_misses) ->Arg(1<<10)->Arg(1<<14)->Arg(1<<18)->Arg(1<<22);
+
+BENCHMARK(BM_bc_pgm_uniform)->Arg(1<<10)->Arg(1<<14)->Arg(1<<18)->Arg(1<<22);
+BENCHMARK(BM_bc_pgm_misses) ->Arg(1<<10)->Arg(1<<14)->Arg(1<<18)->Arg(1<<22);
+
+BENCHMARK(BM_bc_fence_uniform)->Arg(1<<10)->Arg(1<<14)->Arg(1<<18)->Arg(1<<22);
+BENCHMARK(BM_bc_summary_uniform)->Arg(1<<10)->Arg(1<<14)->Arg(1<<18)->Arg(1<<22);
+
+BENCHMARK(BM_bc_compressed_uniform)->Arg(1<<10)->Arg(1<<14)->Arg(1<<18)->Arg(1<<22);
+
+BENCHMARK(BM_bc_elias_fano_uniform)->Arg(1<<10)->Arg(1<<14)->Arg(1<<18)->Arg(1<<22);
+BENCHMARK(BM_bc_elias_fano_misses) ->Arg(1<<10)->Arg(1<<14)->Arg(1<<18)->Arg(1<<22);
+BENCHMARK(BM_bc_elias_fano_front)  ->Arg(1<<10)->Arg(1<<14)->Arg(1<<18)->Arg(1<<22);
+
+BENCHMARK(BM_bc_replicated_uniform)->Arg(1<<10)->Arg(1<<14)->Arg(1<<18)->Arg(1<<22);
+
+BENCHMARK(BM_bc_radix_hint_uniform)->Arg(1<<10)->Arg(1<<14)->Arg(1<<18)->Arg(1<<22);
+BENCHMARK(BM_bc_radix_hint_misses) ->Arg(1<<10)->Arg(1<<14)->Arg(1<<18)->Arg(1<<22);
+
+BENCHMARK(BM_bc_standard_strings)->Arg(1<<10)->Arg(1<<14)->Arg(1<<18);
+BENCHMARK(BM_bc_string_index)    ->Arg(1<<10)->Arg(1<<14)->Arg(1<<18);
+
+BENCHMARK(BM_bc_hybrid16_records)  ->Arg(1<<10)->Arg(1<<14)->Arg(1<<18)->Arg(1<<22);
+BENCHMARK(BM_bc_key_column_records)->Arg(1<<10)->Arg(1<<14)->Arg(1<<18)->Arg(1<<22);
+
+BENCHMARK(BM_bc_standard_batch_uniform)  ->Arg(1<<10)->Arg(1<<14)->Arg(1<<18)->Arg(1<<22);
+BENCHMARK(BM_bc_branchless_batch_uniform)->Arg(1<<10)->Arg(1<<14)->Arg(1<<18)->Arg(1<<22);
+BENCHMARK(BM_std_set_intersection)->Arg(1<<10)->Arg(1<<14)->Arg(1<<18)->Arg(1<<22);
+BENCHMARK(BM_bc_intersect)        ->Arg(1<<10)->Arg(1<<14)->Arg(1<<18)->Arg(1<<22);
+BENCHMARK(BM_bc_intersect_pairwise_chain)->Arg(1<<10)->Arg(1<<14)->Arg(1<<18);
+BENCHMARK(BM_bc_intersect_k)             ->Arg(1<<10)->Arg(1<<14)->Arg(1<<18);
+BENCHMARK(BM_bc_parallel_batch_uniform)  ->Arg(1<<10)->Arg(1<<14)->Arg(1<<18)->Arg(1<<22)->UseRealTime();
+
 BENCHMARK_MAIN();
@@ -0,0 +1,444 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <mutex>
+#include <optional>
+#include <random>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include <boundcraft/details/adaptive/adaptive-fwd.hpp>
+#include <boundcraft/details/isa.hpp>
+#include <boundcraft/details/lower-bound/lower-bound.hpp>
+#include <boundcraft/details/upper-bound/upper-bound.hpp>
+#include <boundcraft/policy.hpp>
+#include <boundcraft/traits.hpp>
+
+namespace boundcraft::inline BOUNDCRAFT_ISA::policy
+{
+    // Picks standard_binary, branchless, hybrid<16>, hybrid<64> or a galloping search per call,
+    // from a table of the fastest kernel per range length measured on this host (see
+    // boundcraft::adaptive_tuning). Lower and upper bounds, over ascending (std::less) and
+    // descending (std::greater) ranges, each have their own table; other comparators use the
+    // std::less tables. A table missing on first use is calibrated then, on the calling thread:
+    // call adaptive_warm_up<T>() at startup to keep that off the request path. Non-arithmetic
+    // keys search like hybrid<16>.
+    //
+    // The policy is declared here rather than in policy.hpp, so naming it without this header is
+    // a plain "no member named adaptive" error, and any searcher that can name it already sees
+    // the kernel definitions below.
+    struct adaptive final
+    {
+    };
+
+    namespace traits
+    {
+        template <>
+        struct policy_traits<adaptive>
+        {
+            static constexpr policy_kind kind = policy_kind::adaptive;
+        };
+    }
+}
+
+namespace boundcraft::inline BOUNDCRAFT_ISA
+{
+    // Kernels policy::adaptive chooses between.
+    enum class adaptive_kernel : std::uint8_t
+    {
+        standard_binary,
+        branchless,
+        hybrid_16,
+        hybrid_64,
+        gallop_middle // galloping<hybrid<16>, start_middle>
+    };
+
+    inline constexpr std::size_t adaptive_kernel_count = 5;
+
+    // What a table was measured for. Lower and upper bounds probe runs of equal keys differently,
+    // and a descending range reverses every comparison, so each combination is timed on its own.
+    enum class adaptive_search : std::uint8_t
+    {
+        lower_bound,
+        upper_bound
+    };
+
+    enum class adaptive_order : std::uint8_t
+    {
+        ascending, // std::less, and any comparator that is neither std::less nor std::greater
+        descending // std::greater
+    };
+
+    // Kernel to use per range length, bucketed by floor(log2(length)). serialize()/parse() turn
+    // it into a short text line so a host can store its calibration and skip it on restart.
+    class adaptive_table final
+    {
+    public:
+        static constexpr std::size_t buckets = 64;
+        static constexpr std::string_view format_tag = "boundcraft-adaptive-v1";
+
+        adaptive_table() noexcept { kernels_.fill(adaptive_kernel::hybrid_16); }
+
+        static std::size_t bucket_of(std::size_t n) noexcept
+        {
+            return n == 0 ? 0 : static_cast<std::size_t>(std::bit_width(n)) - 1;
+        }
+
+        adaptive_kernel kernel_for(std::size_t n) const noexcept { return kernels_[bucket_of(n)]; }
+        adaptive_kernel operator[](std::size_t bucket) const noexcept { return kernels_[bucket]; }
+        void set(std::size_t bucket, adaptive_kernel kernel) noexcept { kernels_[bucket] = kernel; }
+
+        bool operator==(const adaptive_table &) const = default;
+
+        // format_tag, a space, then one digit (the kernel's value) per bucket.
+        std::string serialize() const
+        {
+            std::string text(format_tag);
+            text.push_back(' ');
+            for (adaptive_kernel k : kernels_)
+            {
+                text.push_back(static_cast<char>('0' + static_cast<int>(k)));
+            }
+            return text;
+        }
+
+        // Returns nullopt for anything serialize() could not have produced (trailing whitespace
+        // is ignored).
+        static std::optional<adaptive_table> parse(std::string_view text)
+        {
+            while (!text.empty() && (text.back() == '\n' || text.back() == '\r' || text.back() == ' '))
+            {
+                text.remove_suffix(1);
+            }
+            if (text.size() != format_tag.size() + 1 + buckets || !text.starts_with(format_tag) ||
+                text[format_tag.size()] != ' ')
+            {
+                return std::nullopt;
+            }
+
+            adaptive_table table;
+            for (std::size_t b = 0; b < buckets; ++b)
+            {
+                const char c = text[format_tag.size() + 1 + b];
+                if (c < '0' || c >= static_cast<char>('0' + adaptive_kernel_count))
+                {
+                    return std::nullopt;
+                }
+                table.set(b, static_cast<adaptive_kernel>(c - '0'));
+            }
+            return table;
+        }
+
+    private:
+        std::array<adaptive_kernel, buckets> kernels_;
+    };
+
+    struct adaptive_calibration
+    {
+        std::size_t max_log2 = 20; // longest range timed is 2^max_log2; longer ones reuse its choice
+        std::size_t queries = 512; // lookups timed per kernel and length
+        std::size_t rounds = 3;    // best of this many runs, against timer and scheduler noise
+    };
+
+    namespace detail
+    {
+        template <class It>
+        inline constexpr bool adaptive_eligible_v =
+            std::random_access_iterator<It> && std::is_arithmetic_v<std::iter_value_t<It>>;
+
+        template <class It, class V, class Comp>
+        It lower_bound_kernel(adaptive_kernel kernel, It first, It last, const V &value, Comp comp)
+        {
+            switch (kernel)
+            {
+            case adaptive_kernel::standard_binary:
+                return lower_bound_standard_binary_impl(first, last, value, comp);
+            case adaptive_kernel::branchless:
+                return lower_bound_branchless_impl(first, last, value, comp);
+            case adaptive_kernel::hybrid_64:
+                return lower_bound_hybrid_impl(64, first, last, value, comp);
+            case adaptive_kernel::gallop_middle:
+                return lower_bound_gallop_impl<boundcraft::policy::hybrid<16>, boundcraft::policy::gallop::start_middle>(first, last, value, comp);
+            case adaptive_kernel::hybrid_16:
+            default:
+                return lower_bound_hybrid_impl(16, first, last, value, comp);
+            }
+        }
+
+        template <class It, class V, class Comp>
+        It upper_bound_kernel(adaptive_kernel kernel, It first, It last, const V &value, Comp comp)
+        {
+            switch (kernel)
+            {
+            case adaptive_kernel::standard_binary:
+                return upper_bound_standard_binary_impl(first, last, value, comp);
+            case adaptive_kernel::branchless:
+                return upper_bound_branchless_impl(first, last, value, comp);
+            case adaptive_kernel::hybrid_64:
+                return upper_bound_hybrid_impl(64, first, last, value, comp);
+            case adaptive_kernel::gallop_middle:
+                return upper_bound_gallop_impl<boundcraft::policy::hybrid<16>, boundcraft::policy::gallop::start_middle>(first, last, value, comp);
+            case adaptive_kernel::hybrid_16:
+            default:
+                return upper_bound_hybrid_impl(16, first, last, value, comp);
+            }
+        }
+
+        template <adaptive_search Search, class It, class V, class Comp>
+        It search_kernel(adaptive_kernel kernel, It first, It last, const V &value, Comp comp)
+        {
+            if constexpr (Search == adaptive_search::lower_bound)
+            {
+                return lower_bound_kernel(kernel, first, last, value, comp);
+            }
+            else
+            {
+                return upper_bound_kernel(kernel, first, last, value, comp);
+            }
+        }
+
+        template <class Comp, class T>
+        inline constexpr adaptive_order adaptive_order_v =
+            is_greater_comp_v<Comp, T> ? adaptive_order::descending : adaptive_order::ascending;
+
+        // Sorted keys spread over T's range (or a wide slice of it for floating point).
+        template <class T>
+        std::vector<T> calibration_keys(std::size_t n, std::mt19937_64 &rng)
+        {
+            std::vector<T> keys(n);
+            if constexpr (std::is_floating_point_v<T>)
+            {
+                std::uniform_real_distribution<double> dist(-1e9, 1e9);
+                for (auto &k : keys) k = static_cast<T>(dist(rng));
+            }
+            else if constexpr (std::is_signed_v<T>)
+            {
+                std::uniform_int_distribution<long long> dist(std::numeric_limits<T>::lowest(), std::numeric_limits<T>::max());
+                for (auto &k : keys) k = static_cast<T>(dist(rng));
+            }
+            else
+            {
+                std::uniform_int_distribution<unsigned long long> dist(0, std::numeric_limits<T>::max());
+                for (auto &k : keys) k = static_cast<T>(dist(rng));
+            }
+            std::sort(keys.begin(), keys.end());
+            return keys;
+        }
+
+        // Times every kernel at lengths 1, 2, 4, ..., 2^max_log2 on random lookups (half of them
+        // present keys) and keeps the fastest per length.
+        template <class T, adaptive_search Search, adaptive_order Order>
+        adaptive_table calibrate_table(const adaptive_calibration &options)
+        {
+            using comp_t = std::conditional_t<Order == adaptive_order::ascending, std::less<>, std::greater<>>;
+
+            using clock = std::chrono::steady_clock;
+
+            const std::size_t max_log2 = std::min<std::size_t>(options.max_log2, 30);
+            const std::size_t queries = std::max<std::size_t>(options.queries, 1);
+            const std::size_t rounds = std::max<std::size_t>(options.rounds, 1);
+
+            std::mt19937_64 rng(0x5eed);
+            std::vector<T> keys = calibration_keys<T>(std::size_t{1} << max_log2, rng);
+            if constexpr (Order == adaptive_order::descending)
+            {
+                std::reverse(keys.begin(), keys.end());
+            }
+            std::vector<T> probes(queries);
+
+            adaptive_table table;
+            std::size_t sink = 0;
+            for (std::size_t b = 0; b <= max_log2; ++b)
+            {
+                const std::size_t n = std::size_t{1} << b;
+                const T *first = keys.data();
+                const T *last = keys.data() + n;
+
+                std::uniform_int_distribution<std::size_t> pick(0, n - 1);
+                for (std::size_t q = 0; q < queries; ++q)
+                {
+                    const T a = first[pick(rng)];
+                    const T c = first[pick(rng)];
+                    probes[q] = (q % 2 == 0) ? a : static_cast<T>(a / 2 + c / 2);
+                }
+
+                auto best_kernel = adaptive_kernel::hybrid_16;
+                auto best_time = clock::duration::max();
+                for (std::size_t k = 0; k < adaptive_kernel_count; ++k)
+                {
+                    const auto kernel = static_cast<adaptive_kernel>(k);
+                    for (std::size_t r = 0; r < rounds; ++r)
+                    {
+                        const auto start = clock::now();
+                        for (const T &p : probes)
+                        {
+                            sink += static_cast<std::size_t>(search_kernel<Search>(kernel, first, last, p, comp_t{}) - first);
+                        }
+                        const auto elapsed = clock::now() - start;
+                        if (elapsed < best_time)
+                        {
+                            best_time = elapsed;
+                            best_kernel = kernel;
+                        }
+                    }
+                }
+                table.set(b, best_kernel);
+            }
+
+            for (std::size_t b = max_log2 + 1; b < adaptive_table::buckets; ++b)
+            {
+                table.set(b, table[max_log2]);
+            }
+
+            // Keeps the timed loops from being optimised away.
+            volatile std::size_t keep = sink;
+            (void)keep;
+            return table;
+        }
+    }
+
+    // Kernel table behind policy::adaptive for one key type, search direction and order. The
+    // first adaptive search that needs it calibrates with the default options, holding a lock,
+    // unless a table was loaded or calibrated before; later searches read it without locking.
+    template <class T, adaptive_search Search = adaptive_search::lower_bound, adaptive_order Order = adaptive_order::ascending>
+    class adaptive_tuning final
+    {
+        static_assert(std::is_arithmetic_v<T>, "Boundcraft: adaptive tuning is kept for arithmetic key types");
+
+    public:
+        adaptive_tuning() = delete;
+
+        // Calibrates now (e.g. at startup, off the request path), installs and returns the table.
+        static adaptive_table calibrate(const adaptive_calibration &options = {})
+        {
+            adaptive_table table = boundcraft::detail::calibrate_table<T, Search, Order>(options);
+            load(table);
+            return table;
+        }
+
+        // Installs a table, typically one saved from an earlier calibration on the same host.
+        static void load(const adaptive_table &table)
+        {
+            auto &s = state();
+            std::lock_guard lock(s.mutex);
+            install(s, table);
+        }
+
+        static bool calibrated() noexcept { return state().ready.load(std::memory_order_acquire); }
+
+        // The installed table, calibrating first if there is none.
+        static adaptive_table table()
+        {
+            ensure_ready();
+            auto &s = state();
+            adaptive_table t;
+            for (std::size_t b = 0; b < adaptive_table::buckets; ++b)
+            {
+                t.set(b, static_cast<adaptive_kernel>(s.kernels[b].load(std::memory_order_relaxed)));
+            }
+            return t;
+        }
+
+        static adaptive_kernel kernel_for(std::size_t n)
+        {
+            ensure_ready();
+            return static_cast<adaptive_kernel>(state().kernels[adaptive_table::bucket_of(n)].load(std::memory_order_relaxed));
+        }
+
+    private:
+        struct tuning_state
+        {
+            std::array<std::atomic<std::uint8_t>, adaptive_table::buckets> kernels{};
+            std::atomic<bool> ready{false};
+            std::mutex mutex;
+        };
+
+        static tuning_state &state() noexcept
+        {
+            static tuning_state s;
+            return s;
+        }
+
+        static void install(tuning_state &s, const adaptive_table &table) noexcept
+        {
+            for (std::size_t b = 0; b < adaptive_table::buckets; ++b)
+            {
+                s.kernels[b].store(static_cast<std::uint8_t>(table[b]), std::memory_order_relaxed);
+            }
+            s.ready.store(true, std::memory_order_release);
+        }
+
+        static void ensure_ready()
+        {
+            auto &s = state();
+            if (s.ready.load(std::memory_order_acquire))
+            {
+                return;
+            }
+
+            // Concurrent first uses wait for one calibration instead of each running their own.
+            std::lock_guard lock(s.mutex);
+            if (!s.ready.load(std::memory_order_acquire))
+            {
+                install(s, boundcraft::detail::calibrate_table<T, Search, Order>({}));
+            }
+        }
+    };
+
+    // Calibrates all four tables for T (both directions, both orders), e.g. at startup, so no
+    // adaptive search over T pays for calibration on the request path.
+    template <class T>
+    void adaptive_warm_up(const adaptive_calibration &options = {})
+    {
+        adaptive_tuning<T, adaptive_search::lower_bound, adaptive_order::ascending>::calibrate(options);
+        adaptive_tuning<T, adaptive_search::upper_bound, adaptive_order::ascending>::calibrate(options);
+        adaptive_tuning<T, adaptive_search::lower_bound, adaptive_order::descending>::calibrate(options);
+        adaptive_tuning<T, adaptive_search::upper_bound, adaptive_order::descending>::calibrate(options);
+    }
+
+    namespace detail
+    {
+        // Random-access ranges of arithmetic keys use the calibrated kernel for their length;
+        // anything else searches like hybrid<16>.
+        template <class It, class V, class Comp>
+        It lower_bound_adaptive_impl(It first, It last, const V &value, Comp comp)
+        {
+            if constexpr (adaptive_eligible_v<It>)
+            {
+                using key_t = std::remove_cv_t<std::iter_value_t<It>>;
+                using tuning = adaptive_tuning<key_t, adaptive_search::lower_bound, adaptive_order_v<Comp, key_t>>;
+                return lower_bound_kernel(tuning::kernel_for(static_cast<std::size_t>(last - first)), first, last, value, comp);
+            }
+            else
+            {
+                return lower_bound_hybrid_impl(16, first, last, value, comp);
+            }
+        }
+
+        template <class It, class V, class Comp>
+        It upper_bound_adaptive_impl(It first, It last, const V &value, Comp comp)
+        {
+            if constexpr (adaptive_eligible_v<It>)
+            {
+                using key_t = std::remove_cv_t<std::iter_value_t<It>>;
+                using tuning = adaptive_tuning<key_t, adaptive_search::upper_bound, adaptive_order_v<Comp, key_t>>;
+                return upper_bound_kernel(tuning::kernel_for(static_cast<std::size_t>(last - first)), first, last, value, comp);
+            }
+            else
+            {
+                return upper_bound_hybrid_impl(16, first, last, value, comp);
+            }
+        }
+    }
+}
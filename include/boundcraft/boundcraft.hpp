@@ -1,6 +1,23 @@
 #pragma once
 
 #include <boundcraft/searcher.hpp>
+#include <boundcraft/adaptive.hpp>
+#include <boundcraft/cursor.hpp>
+#include <boundcraft/parallel-batch.hpp>
+#include <boundcraft/thread-pool.hpp>
+#include <boundcraft/eytzinger-index.hpp>
+#include <boundcraft/fence-index.hpp>
+#include <boundcraft/summary-index.hpp>
+#include <boundcraft/key-column-index.hpp>
+#include <boundcraft/compressed-array.hpp>
+#include <boundcraft/elias-fano.hpp>
+#include <boundcraft/mapped-array.hpp>
+#include <boundcraft/replicated-index.hpp>
+#include <boundcraft/s-tree.hpp>
+#include <boundcraft/pgm-index.hpp>
+#include <boundcraft/radix-hint-index.hpp>
+#include <boundcraft/string-index.hpp>
+#include <boundcraft/set-ops.hpp>
 #include <boundcraft/policy.hpp>
 #include <boundcraft/traits.hpp>
 
@@ -0,0 +1,183 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+#include <boundcraft/details/aligned-allocator.hpp>
+#include <boundcraft/details/compressed/bitpack.hpp>
+#include <boundcraft/details/isa.hpp>
+#include <boundcraft/details/lower-bound/lower-bound-hybrid-impl.hpp>
+#include <boundcraft/details/upper-bound/upper-bound-hybrid-impl.hpp>
+#include <boundcraft/policy.hpp>
+#include <boundcraft/searcher.hpp>
+
+namespace boundcraft::inline BOUNDCRAFT_ISA
+{
+    // Searchable compressed copy of a sorted uint32/uint64 column (ascending, std::less order).
+    //
+    // Keys are cut into blocks of 128. Each block keeps its first key as an uncompressed header
+    // and stores every key as its offset from that header (frame of reference), bit-packed at
+    // the width of the block's largest offset. A lookup searches the dense header array with
+    // Search_Policy, unpacks the single block that can hold the answer (SIMD when built for
+    // SSE4.2/AVX2), and finishes in the offset domain with the hybrid scan, so only the headers
+    // and one block are touched.
+    //
+    // uint64 blocks whose offsets need more than 32 bits are stored unpacked.
+    template <class T, class Search_Policy = boundcraft::policy::hybrid<16>>
+    class compressed_array final
+    {
+        static_assert(std::is_same_v<T, std::uint32_t> || std::is_same_v<T, std::uint64_t>,
+                      "Boundcraft: compressed_array stores uint32_t or uint64_t keys");
+
+    public:
+        static constexpr std::size_t block_keys = boundcraft::detail::bitpack::block_values;
+
+        compressed_array() = default;
+
+        explicit compressed_array(std::span<const T> sorted) : size_(sorted.size())
+        {
+            const std::size_t blocks = (size_ + block_keys - 1) / block_keys;
+            headers_.reserve(blocks);
+            blocks_.reserve(blocks);
+
+            std::uint32_t offsets[block_keys];
+            for (std::size_t b = 0; b < blocks; ++b)
+            {
+                const std::size_t first = b * block_keys;
+                const std::size_t count = std::min(block_keys, size_ - first);
+                const T header = sorted[first];
+                const T span = sorted[first + count - 1] - header;
+
+                headers_.push_back(header);
+                const unsigned bits = static_cast<unsigned>(std::bit_width(span));
+                blocks_.push_back({words_.size(), bits});
+
+                if (bits > 32)
+                {
+                    // Raw 64-bit offsets; the last offset repeats to fill a partial block.
+                    words_.resize(words_.size() + 2 * block_keys);
+                    for (std::size_t e = 0; e < block_keys; ++e)
+                    {
+                        const std::uint64_t off = sorted[first + std::min(e, count - 1)] - header;
+                        std::memcpy(words_.data() + blocks_.back().offset + 2 * e, &off, sizeof(off));
+                    }
+                    continue;
+                }
+
+                for (std::size_t e = 0; e < block_keys; ++e)
+                {
+                    offsets[e] = static_cast<std::uint32_t>(sorted[first + std::min(e, count - 1)] - header);
+                }
+                words_.resize(words_.size() + boundcraft::detail::bitpack::packed_words(bits), 0);
+                boundcraft::detail::bitpack::pack(offsets, bits, words_.data() + blocks_.back().offset);
+            }
+        }
+
+        std::size_t size() const noexcept { return size_; }
+        bool empty() const noexcept { return size_ == 0; }
+        std::size_t block_count() const noexcept { return headers_.size(); }
+
+        // Compressed footprint: headers, block descriptors and packed offsets.
+        std::size_t memory_bytes() const noexcept
+        {
+            return headers_.size() * sizeof(T) + blocks_.size() * sizeof(block) + words_.size() * sizeof(std::uint32_t);
+        }
+
+        // Decodes a single key.
+        T operator[](std::size_t i) const noexcept
+        {
+            const std::size_t b = i / block_keys;
+            const std::size_t e = i % block_keys;
+            const block &blk = blocks_[b];
+
+            if (blk.bits > 32)
+            {
+                std::uint64_t off;
+                std::memcpy(&off, words_.data() + blk.offset + 2 * e, sizeof(off));
+                return static_cast<T>(headers_[b] + off);
+            }
+            return static_cast<T>(headers_[b] + boundcraft::detail::bitpack::extract(words_.data() + blk.offset, blk.bits, e));
+        }
+
+        // Positions in sorted order, like the layout indexes.
+        std::size_t lower_bound(const T &value) const
+        {
+            // Blocks whose header is below value end before the answer and the first block whose
+            // header is not below it starts at or after the answer, so it lies in the block before.
+            const T *h = searcher<Search_Policy>{}.lower_bound(headers_.data(), headers_.data() + headers_.size(), value, std::less<>{});
+            const std::size_t f = static_cast<std::size_t>(h - headers_.data());
+            if (f == 0)
+            {
+                return 0;
+            }
+            return search_block<true>(f - 1, value);
+        }
+
+        std::size_t upper_bound(const T &value) const
+        {
+            const T *h = searcher<Search_Policy>{}.upper_bound(headers_.data(), headers_.data() + headers_.size(), value, std::less<>{});
+            const std::size_t f = static_cast<std::size_t>(h - headers_.data());
+            if (f == 0)
+            {
+                return 0;
+            }
+            return search_block<false>(f - 1, value);
+        }
+
+    private:
+        struct block
+        {
+            std::size_t offset; // first word of the block in words_
+            unsigned bits;      // packed width; > 32 means raw 64-bit offsets
+        };
+
+        static constexpr std::size_t scan_threshold = 16;
+
+        // value >= headers_[b] on entry, so it can be searched as an offset from the header.
+        template <bool Lower>
+        std::size_t search_block(std::size_t b, const T &value) const
+        {
+            const block &blk = blocks_[b];
+            const std::size_t first = b * block_keys;
+            const std::size_t count = std::min(block_keys, size_ - first);
+            const T target = value - headers_[b];
+
+            if (blk.bits > 32)
+            {
+                alignas(boundcraft::detail::cache_line_bytes) std::uint64_t offsets[block_keys];
+                std::memcpy(offsets, words_.data() + blk.offset, sizeof(offsets));
+                return first + position<Lower>(offsets, count, static_cast<std::uint64_t>(target));
+            }
+
+            if (target > std::numeric_limits<std::uint32_t>::max())
+            {
+                return first + count;
+            }
+
+            alignas(boundcraft::detail::cache_line_bytes) std::uint32_t offsets[block_keys];
+            boundcraft::detail::bitpack::unpack(words_.data() + blk.offset, blk.bits, offsets);
+            return first + position<Lower>(offsets, count, static_cast<std::uint32_t>(target));
+        }
+
+        template <bool Lower, class U>
+        static std::size_t position(const U *offsets, std::size_t count, U target)
+        {
+            const U *it = Lower ? boundcraft::detail::lower_bound_hybrid_impl(scan_threshold, offsets, offsets + count, target, std::less<>{})
+                                : boundcraft::detail::upper_bound_hybrid_impl(scan_threshold, offsets, offsets + count, target, std::less<>{});
+            return static_cast<std::size_t>(it - offsets);
+        }
+
+        std::size_t size_ = 0;
+        std::vector<T> headers_;
+        std::vector<block> blocks_;
+        std::vector<std::uint32_t, boundcraft::detail::aligned_allocator<std::uint32_t>> words_;
+    };
+}
@@ -0,0 +1,100 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <span>
+
+#include <boundcraft/details/isa.hpp>
+#include <boundcraft/searcher.hpp>
+
+namespace boundcraft::inline BOUNDCRAFT_ISA
+{
+    // Finger search over one sorted range. Every lookup gallops from the previous result with
+    // lower_bound_expand_left/right, so sorted or nearly sorted key streams cost O(log distance)
+    // per lookup instead of O(log n).
+    //
+    // A cursor owns no shared state: the range is only read, and the finger lives in the cursor.
+    // Keep one cursor per thread; any number of cursors may share the same range.
+    //
+    // Policy is the search used inside the galloped bracket (standard_binary, branchless or
+    // hybrid). A galloping policy may be passed too, in which case its inner policy is used.
+    template <class Policy, std::random_access_iterator It>
+    class cursor final
+    {
+    public:
+        using iterator = It;
+        using search_policy = boundcraft::policy::traits::inner_search_policy_t<Policy>;
+
+        cursor(It first, It last) : first_(first), last_(last), finger_(first) {}
+
+        template <class V>
+        It lower_bound(const V &value)
+        {
+            return lower_bound(value, std::less<>{});
+        }
+
+        template <class V, class Comp>
+            requires one_way_lower<Comp, It, V>
+        It lower_bound(const V &value, Comp comp)
+        {
+            if (first_ == last_)
+            {
+                return first_;
+            }
+            finger_ = boundcraft::detail::lower_bound_gallop_from<search_policy>(first_, last_, start_point(), value, comp);
+            return finger_;
+        }
+
+        template <class V>
+        It upper_bound(const V &value)
+        {
+            return upper_bound(value, std::less<>{});
+        }
+
+        template <class V, class Comp>
+            requires one_way_upper<Comp, It, V>
+        It upper_bound(const V &value, Comp comp)
+        {
+            if (first_ == last_)
+            {
+                return first_;
+            }
+            finger_ = boundcraft::detail::upper_bound_gallop_from<search_policy>(first_, last_, start_point(), value, comp);
+            return finger_;
+        }
+
+        // Result of the previous lookup (begin() before the first one).
+        It position() const noexcept { return finger_; }
+
+        // Moves the finger, e.g. to resume a merge from a known position. Must lie in [begin(), end()].
+        void seek(It finger) noexcept { finger_ = finger; }
+
+        void reset() noexcept { finger_ = first_; }
+
+        It begin() const noexcept { return first_; }
+        It end() const noexcept { return last_; }
+
+    private:
+        It start_point() const noexcept
+        {
+            return (finger_ == last_) ? last_ - 1 : finger_;
+        }
+
+        It first_;
+        It last_;
+        It finger_;
+    };
+
+    template <class Policy, std::random_access_iterator It>
+    cursor<Policy, It> make_cursor(It first, It last)
+    {
+        return cursor<Policy, It>(first, last);
+    }
+
+    template <class Policy, class T>
+    cursor<Policy, T *> make_cursor(std::span<T> s)
+    {
+        return cursor<Policy, T *>(s.data(), s.data() + s.size());
+    }
+}
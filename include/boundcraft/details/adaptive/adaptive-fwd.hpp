@@ -0,0 +1,20 @@
+#pragma once
+
+#include <boundcraft/details/isa.hpp>
+
+// Declarations the search dispatch needs for policy::adaptive. The definitions, together with
+// the policy itself and the calibration machinery (<mutex>, <random>, <chrono>), live in
+// <boundcraft/adaptive.hpp>, so plain searcher users do not pay for them. Only code that has
+// included that header can name policy::adaptive, so the definitions are always visible where
+// these are instantiated.
+
+namespace boundcraft::inline BOUNDCRAFT_ISA::detail
+{
+
+    template <class It, class V, class Comp>
+    It lower_bound_adaptive_impl(It first, It last, const V &value, Comp comp);
+
+    template <class It, class V, class Comp>
+    It upper_bound_adaptive_impl(It first, It last, const V &value, Comp comp);
+
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <cstddef>
+#include <new>
+
+#include <boundcraft/details/isa.hpp>
+
+namespace boundcraft::inline BOUNDCRAFT_ISA::detail
+{
+    inline constexpr std::size_t cache_line_bytes = 64;
+
+    // Cache-line size of the target as the compiler sees it, for sizing scans rather than
+    // layouts: storage keeps the fixed cache_line_bytes alignment so it does not change with
+    // -mtune. GCC warns on every use of the library constant since its value is not ABI-stable.
+#if defined(__cpp_lib_hardware_interference_size)
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Winterference-size"
+#endif
+    inline constexpr std::size_t target_cache_line_bytes = std::hardware_destructive_interference_size;
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#else
+    inline constexpr std::size_t target_cache_line_bytes = cache_line_bytes;
+#endif
+
+    // Minimal allocator that hands out Align-aligned storage, used by the index layouts so that
+    // node/block boundaries line up with cache lines.
+    template <class T, std::size_t Align = cache_line_bytes>
+    struct aligned_allocator
+    {
+        static_assert(Align >= alignof(T), "aligned_allocator: Align must not weaken T's alignment");
+
+        using value_type = T;
+
+        template <class U>
+        struct rebind
+        {
+            using other = aligned_allocator<U, Align>;
+        };
+
+        aligned_allocator() noexcept = default;
+
+        template <class U>
+        aligned_allocator(const aligned_allocator<U, Align> &) noexcept {}
+
+        [[nodiscard]] T *allocate(std::size_t n)
+        {
+            return static_cast<T *>(::operator new(n * sizeof(T), std::align_val_t{Align}));
+        }
+
+        void deallocate(T *p, std::size_t) noexcept
+        {
+            ::operator delete(p, std::align_val_t{Align});
+        }
+
+        template <class U>
+        bool operator==(const aligned_allocator<U, Align> &) const noexcept { return true; }
+    };
+}
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__BMI2__)
+#include <immintrin.h>
+#endif
+
+#include <boundcraft/details/isa.hpp>
+
+// Rank/select primitives over plain 64-bit word bitvectors (bit i is bit i % 64 of word i / 64).
+
+namespace boundcraft::inline BOUNDCRAFT_ISA::detail::bits
+{
+
+    // Position of the k-th (0-based) set bit of w; w must have more than k set bits. The pdep
+    // path is chosen by __BMI2__, which is part of the BOUNDCRAFT_ISA tag, so BMI2 and baseline
+    // units never share this symbol.
+    inline unsigned select_in_word(std::uint64_t w, unsigned k) noexcept
+    {
+#if defined(__BMI2__)
+        return static_cast<unsigned>(std::countr_zero(_pdep_u64(std::uint64_t{1} << k, w)));
+#else
+        for (; k > 0; --k)
+        {
+            w &= w - 1;
+        }
+        return static_cast<unsigned>(std::countr_zero(w));
+#endif
+    }
+
+    // Position of the k-th set bit at or after bit `from`; that bit must exist.
+    inline std::size_t select_one_from(const std::uint64_t *words, std::size_t from, std::size_t k) noexcept
+    {
+        std::size_t w = from / 64;
+        std::uint64_t word = words[w] & (~std::uint64_t{0} << (from % 64));
+        for (;;)
+        {
+            const auto c = static_cast<std::size_t>(std::popcount(word));
+            if (k < c)
+            {
+                return w * 64 + select_in_word(word, static_cast<unsigned>(k));
+            }
+            k -= c;
+            word = words[++w];
+        }
+    }
+
+    // Same for clear bits; the k-th clear bit must lie inside the vector.
+    inline std::size_t select_zero_from(const std::uint64_t *words, std::size_t from, std::size_t k) noexcept
+    {
+        std::size_t w = from / 64;
+        std::uint64_t word = ~words[w] & (~std::uint64_t{0} << (from % 64));
+        for (;;)
+        {
+            const auto c = static_cast<std::size_t>(std::popcount(word));
+            if (k < c)
+            {
+                return w * 64 + select_in_word(word, static_cast<unsigned>(k));
+            }
+            k -= c;
+            word = ~words[++w];
+        }
+    }
+
+}
@@ -0,0 +1,115 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__AVX2__) || defined(__SSE4_2__)
+#include <immintrin.h>
+#endif
+
+#include <boundcraft/details/isa.hpp>
+
+// Vertical 4-lane bit-packing of 128 unsigned 32-bit values (the SIMD-BP128 layout).
+// Value e goes to lane e % 4 at slot e / 4; each lane is a stream of `bits`-wide slots packed
+// into 32-bit words, and word w of lane l is stored at words[4 * w + l]. A block therefore
+// takes 4 * bits words, and one 128-bit load yields the same word of all four lanes, so the
+// unpacker extracts four values per shift/mask with no cross-lane shuffles.
+
+namespace boundcraft::inline BOUNDCRAFT_ISA::detail::bitpack
+{
+
+    inline constexpr std::size_t block_values = 128;
+    inline constexpr std::size_t lanes = 4;
+    inline constexpr std::size_t slots_per_lane = block_values / lanes;
+
+    inline constexpr std::size_t packed_words(unsigned bits) noexcept { return lanes * bits; }
+
+    // `words` must hold packed_words(bits) zeroed words; values must fit in `bits` bits.
+    inline void pack(const std::uint32_t *values, unsigned bits, std::uint32_t *words) noexcept
+    {
+        if (bits == 0)
+        {
+            return;
+        }
+        for (std::size_t e = 0; e < block_values; ++e)
+        {
+            const std::size_t lane = e % lanes;
+            const std::size_t bit = (e / lanes) * bits;
+            const std::size_t word = bit / 32;
+            const unsigned shift = static_cast<unsigned>(bit % 32);
+
+            words[lanes * word + lane] |= values[e] << shift;
+            if (shift + bits > 32)
+            {
+                words[lanes * (word + 1) + lane] |= values[e] >> (32 - shift);
+            }
+        }
+    }
+
+    inline std::uint32_t extract(const std::uint32_t *words, unsigned bits, std::size_t e) noexcept
+    {
+        if (bits == 0)
+        {
+            return 0;
+        }
+        const std::uint32_t mask = bits == 32 ? ~std::uint32_t{0} : (std::uint32_t{1} << bits) - 1;
+        const std::size_t lane = e % lanes;
+        const std::size_t bit = (e / lanes) * bits;
+        const std::size_t word = bit / 32;
+        const unsigned shift = static_cast<unsigned>(bit % 32);
+
+        std::uint32_t v = words[lanes * word + lane] >> shift;
+        if (shift + bits > 32)
+        {
+            v |= words[lanes * (word + 1) + lane] << (32 - shift);
+        }
+        return v & mask;
+    }
+
+    // Decodes all 128 values of a block into `out`. The body depends on the target's vector
+    // extensions; the BOUNDCRAFT_ISA namespace keeps the SSE build a separate symbol from the
+    // scalar one.
+    inline void unpack(const std::uint32_t *words, unsigned bits, std::uint32_t *out) noexcept
+    {
+        if (bits == 0)
+        {
+            for (std::size_t e = 0; e < block_values; ++e)
+            {
+                out[e] = 0;
+            }
+            return;
+        }
+
+#if defined(__AVX2__) || defined(__SSE4_2__)
+        const __m128i mask = _mm_set1_epi32(bits == 32 ? -1 : static_cast<int>((std::uint32_t{1} << bits) - 1));
+        const __m128i *in = reinterpret_cast<const __m128i *>(words);
+
+        __m128i current = _mm_loadu_si128(in++);
+        unsigned shift = 0;
+        for (std::size_t slot = 0; slot < slots_per_lane; ++slot)
+        {
+            __m128i v = _mm_srl_epi32(current, _mm_cvtsi32_si128(static_cast<int>(shift)));
+            shift += bits;
+            if (shift >= 32)
+            {
+                shift -= 32;
+                if (slot + 1 < slots_per_lane || shift > 0)
+                {
+                    current = _mm_loadu_si128(in++);
+                    if (shift > 0)
+                    {
+                        v = _mm_or_si128(v, _mm_sll_epi32(current, _mm_cvtsi32_si128(static_cast<int>(bits - shift))));
+                    }
+                }
+            }
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(out + lanes * slot), _mm_and_si128(v, mask));
+        }
+#else
+        for (std::size_t e = 0; e < block_values; ++e)
+        {
+            out[e] = extract(words, bits, e);
+        }
+#endif
+    }
+
+}
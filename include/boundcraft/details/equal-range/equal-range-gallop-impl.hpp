@@ -0,0 +1,25 @@
+#pragma once
+
+#include <iterator>
+#include <utility>
+
+#include <boundcraft/details/isa.hpp>
+#include <boundcraft/details/upper-bound/upper-bound-gallop-impl.hpp>
+
+namespace boundcraft::inline BOUNDCRAFT_ISA::detail
+{
+
+    // Completes an equal range from an already-found lower bound: the upper bound is the end of
+    // the run of equal keys starting there, so gallop right from it and finish with Search_Policy
+    // inside the bracket. Costs O(log run length) on top of the lower bound.
+    template <class Search_Policy, std::random_access_iterator RandomIt, class V, class Comp>
+    inline std::pair<RandomIt, RandomIt> equal_range_from_lower(RandomIt lower, RandomIt last, const V &value, Comp comp)
+    {
+        if (lower == last)
+        {
+            return {last, last};
+        }
+        return {lower, upper_bound_gallop_from<Search_Policy>(lower, last, lower, value, comp)};
+    }
+
+}
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <utility>
+
+#include <boundcraft/details/isa.hpp>
+#include <boundcraft/details/lower-bound/lower-bound-gallop-impl.hpp>
+#include <boundcraft/details/lower-bound/lower-bound-util.hpp>
+#include <boundcraft/details/upper-bound/upper-bound-gallop-impl.hpp>
+#include <boundcraft/details/upper-bound/upper-bound-util.hpp>
+
+namespace boundcraft::inline BOUNDCRAFT_ISA::detail
+{
+
+    // Three-way bisection shared by both bounds until a probe lands on an equal key. At that
+    // point the lower bound is in [first, mid] and the upper bound in (mid, first + count], so
+    // each is finished with Search_Policy inside its own half instead of the whole range.
+    // Hybrid policies stop bisecting at their threshold and finish both bounds with one scan
+    // each over the remaining window.
+    template <class Search_Policy, class It, class V, class Comp>
+    inline std::pair<It, It> equal_range_split_impl(It first, It last, const V &value, Comp comp)
+    {
+        using ptraits = boundcraft::policy::traits::policy_traits<Search_Policy>;
+        using diff_t = typename std::iterator_traits<It>::difference_type;
+
+        constexpr bool scan_tail = ptraits::kind == policy_kind::hybrid;
+        constexpr diff_t stop = [] {
+            if constexpr (scan_tail)
+                return static_cast<diff_t>(boundcraft::policy::traits::hybrid_threshold_v<Search_Policy, std::iter_value_t<It>>);
+            else
+                return diff_t{0};
+        }();
+
+        diff_t count = std::distance(first, last);
+        while (count > stop)
+        {
+            const diff_t half = count / 2;
+            It mid = std::next(first, half);
+
+            if (comp(*mid, value))
+            {
+                first = std::next(mid);
+                count -= half + 1;
+            }
+            else if (comp(value, *mid))
+            {
+                count = half;
+            }
+            else
+            {
+                It lo = lower_bound_inner_search<Search_Policy>(first, mid, value, comp);
+                It hi = upper_bound_inner_search<Search_Policy>(std::next(mid), std::next(first, count), value, comp);
+                return {lo, hi};
+            }
+        }
+
+        if constexpr (scan_tail)
+        {
+            It lo = lower_bound_linear_scan(first, count, value, comp);
+            It hi = upper_bound_linear_scan(lo, count - std::distance(first, lo), value, comp);
+            return {lo, hi};
+        }
+        else
+        {
+            return {first, first};
+        }
+    }
+
+}
@@ -0,0 +1,4 @@
+#pragma once
+
+#include <boundcraft/details/equal-range/equal-range-gallop-impl.hpp>
+#include <boundcraft/details/equal-range/equal-range-split-impl.hpp>
@@ -0,0 +1,97 @@
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include <boundcraft/details/aligned-allocator.hpp>
+#include <boundcraft/details/isa.hpp>
+#include <boundcraft/details/util.hpp>
+
+namespace boundcraft::inline BOUNDCRAFT_ISA::detail
+{
+
+    // Slots are 1-based: the root is keys[1] and the children of slot k are 2k and 2k + 1.
+    // keys[0] is padding so that the 2^L descendants of slot k start a cache line when keys is
+    // cache-line aligned.
+
+    template <class T>
+    inline void eytzinger_fill(std::span<const T> sorted, T *keys, std::size_t &next, std::size_t k)
+    {
+        if (k > sorted.size())
+        {
+            return;
+        }
+        eytzinger_fill(sorted, keys, next, 2 * k);
+        keys[k] = sorted[next++];
+        eytzinger_fill(sorted, keys, next, 2 * k + 1);
+    }
+
+    // Position in sorted order of the key at slot k of an n-key layout (n for slot 0), computed
+    // from the slot number alone. Slots 1..n form a complete tree of bit_width(n) levels: in the
+    // perfect tree of that height, slot k at depth d, j-th on its level, has in-order rank
+    // (2j + 1) * 2^(levels - d - 1) - 1, and each missing bottom-level slot to its left (the
+    // bottom level only holds its first `bottom` slots, full rank 2i for the i-th) shifts it down by one.
+    inline std::size_t eytzinger_rank(std::size_t k, std::size_t n) noexcept
+    {
+        if (k == 0)
+        {
+            return n;
+        }
+        const auto levels = static_cast<std::size_t>(std::bit_width(n));
+        const auto depth = static_cast<std::size_t>(std::bit_width(k)) - 1;
+        const std::size_t bottom = n - (std::size_t{1} << (levels - 1)) + 1;
+
+        const std::size_t j = k - (std::size_t{1} << depth);
+        const std::size_t full = ((2 * j + 1) << (levels - depth - 1)) - 1;
+        const std::size_t missing_left = (full + 1) / 2;
+        return full - (missing_left > bottom ? missing_left - bottom : 0);
+    }
+
+    // Prefetches the block holding the descendants of slot k, Prefetch_Levels levels down. The
+    // block is sizeof(T) << Prefetch_Levels bytes, so wide keys need more than one line (two for
+    // 8-byte keys at the default depth of 4).
+    // The address is formed through uintptr_t because it may lie past the end of the array.
+    template <std::size_t Prefetch_Levels, class T>
+    [[gnu::always_inline]] inline void eytzinger_prefetch(const T *keys, std::size_t k) noexcept
+    {
+        if constexpr (Prefetch_Levels > 0)
+        {
+            constexpr std::size_t block_bytes = sizeof(T) << Prefetch_Levels;
+            const auto addr = reinterpret_cast<std::uintptr_t>(keys) + (k << Prefetch_Levels) * sizeof(T);
+            for (std::size_t offset = 0; offset < block_bytes; offset += cache_line_bytes)
+            {
+                prefetch(reinterpret_cast<const T *>(addr + offset));
+            }
+        }
+    }
+
+    // Branchless descent; returns the slot of the lower bound or 0 when every key is less.
+    template <std::size_t Prefetch_Levels, class T, class V, class Comp>
+    inline std::size_t eytzinger_lower_bound_slot(const T *keys, std::size_t n, const V &value, Comp comp)
+    {
+        std::size_t k = 1;
+        while (k <= n)
+        {
+            eytzinger_prefetch<Prefetch_Levels>(keys, k);
+            k = 2 * k + static_cast<std::size_t>(comp(keys[k], value));
+        }
+        // Undo the trailing right turns plus the final left turn.
+        return k >> (std::countr_one(k) + 1);
+    }
+
+    template <std::size_t Prefetch_Levels, class T, class V, class Comp>
+    inline std::size_t eytzinger_upper_bound_slot(const T *keys, std::size_t n, const V &value, Comp comp)
+    {
+        std::size_t k = 1;
+        while (k <= n)
+        {
+            eytzinger_prefetch<Prefetch_Levels>(keys, k);
+            k = 2 * k + static_cast<std::size_t>(!comp(value, keys[k]));
+        }
+        return k >> (std::countr_one(k) + 1);
+    }
+
+}
@@ -0,0 +1,33 @@
+#pragma once
+
+// Instruction-set tag for the whole library. Every boundcraft namespace is opened as
+// boundcraft::inline BOUNDCRAFT_ISA, so a template instantiated in a translation unit built with
+// -mavx2 (whose body inlines the AVX2 kernels, or was simply auto-vectorised) has a different
+// mangled name from the same instantiation in a baseline unit. Without the tag both units would
+// emit one weak symbol with two bodies and the linker could hand the AVX2 one to the baseline
+// caller. The inline namespace keeps every name spelled as before (boundcraft::searcher, ...).
+//
+// The tag names the widest vector extension the unit is compiled for, plus _bmi2 when BMI2 is
+// available (the Elias-Fano select uses pdep), e.g. avx2_bmi2 or scalar. Code outside the
+// library that inlines boundcraft calls into its own non-template inline functions is not
+// covered.
+
+#if defined(__AVX512F__)
+#define BOUNDCRAFT_ISA_VECTOR avx512
+#elif defined(__AVX2__)
+#define BOUNDCRAFT_ISA_VECTOR avx2
+#elif defined(__SSE4_2__)
+#define BOUNDCRAFT_ISA_VECTOR sse4_2
+#else
+#define BOUNDCRAFT_ISA_VECTOR scalar
+#endif
+
+#if defined(__BMI2__)
+#define BOUNDCRAFT_ISA_BMI2 _bmi2
+#else
+#define BOUNDCRAFT_ISA_BMI2
+#endif
+
+#define BOUNDCRAFT_ISA_CONCAT_(a, b) a##b
+#define BOUNDCRAFT_ISA_CONCAT(a, b) BOUNDCRAFT_ISA_CONCAT_(a, b)
+#define BOUNDCRAFT_ISA BOUNDCRAFT_ISA_CONCAT(BOUNDCRAFT_ISA_VECTOR, BOUNDCRAFT_ISA_BMI2)
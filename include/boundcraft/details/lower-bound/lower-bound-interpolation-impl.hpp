@@ -0,0 +1,95 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+
+#include <boundcraft/details/isa.hpp>
+#include <boundcraft/details/lower-bound/lower-bound-hybrid-impl.hpp>
+#include <boundcraft/details/lower-bound/lower-bound-util.hpp>
+
+namespace boundcraft::inline BOUNDCRAFT_ISA::detail
+{
+
+    // Interpolation needs numeric keys and a comparator whose order matches their values.
+    template <class It, class V, class Comp>
+    inline constexpr bool interpolation_eligible_v =
+        std::random_access_iterator<It> &&
+        std::is_arithmetic_v<std::iter_value_t<It>> && std::is_arithmetic_v<V> &&
+        (is_less_comp_v<Comp, std::iter_value_t<It>> || is_greater_comp_v<Comp, std::iter_value_t<It>>);
+
+    // Fraction of the way from lo_key to hi_key at which value sits. Works for both ascending
+    // (std::less) and descending (std::greater) ranges because the signs cancel. It is NaN when
+    // the ends collapse in double (64-bit keys above 2^53 a few apart) or are infinite.
+    template <class T, class V>
+    inline double interpolation_fraction(const T &lo_key, const T &hi_key, const V &value)
+    {
+        return (static_cast<double>(value) - static_cast<double>(lo_key)) /
+               (static_cast<double>(hi_key) - static_cast<double>(lo_key));
+    }
+
+    template <class RandomIt>
+    inline RandomIt interpolation_probe_point(RandomIt first, RandomIt last, double fraction)
+    {
+        using diff_t = typename std::iterator_traits<RandomIt>::difference_type;
+
+        const diff_t n = last - first;
+        if (!(fraction >= 0.0 && fraction <= 1.0))
+        {
+            // No usable estimate (NaN, or rounding outside the range): probe the middle. The
+            // check must come before the cast, which is undefined for NaN and out-of-range values.
+            return first + n / 2;
+        }
+        const diff_t estimate = static_cast<diff_t>(fraction * static_cast<double>(n - 1));
+        return first + std::clamp<diff_t>(estimate, 1, n - 1);
+    }
+
+    template <std::size_t Max_Probes, std::size_t Threshold, class It, class V, class Comp>
+    inline It lower_bound_interpolation_impl(It first, It last, const V &value, Comp comp)
+    {
+        if constexpr (!interpolation_eligible_v<It, V, Comp>)
+        {
+            return lower_bound_hybrid_impl(Threshold, first, last, value, comp);
+        }
+        else
+        {
+            using diff_t = typename std::iterator_traits<It>::difference_type;
+
+            for (std::size_t probe = 0; probe < Max_Probes && last - first > static_cast<diff_t>(Threshold); ++probe)
+            {
+                if (!comp(*first, value))
+                {
+                    return first;
+                }
+                if (comp(*(last - 1), value))
+                {
+                    return last;
+                }
+
+                // *first < value <= *(last - 1), so the answer lies in (first, last - 1].
+                const diff_t before = last - first;
+                const It mid = interpolation_probe_point(first, last, interpolation_fraction(*first, *(last - 1), value));
+
+                if (comp(*mid, value))
+                {
+                    first = mid + 1;
+                }
+                else
+                {
+                    last = mid;
+                }
+
+                // A poor estimate barely shrinks the range; follow it with a binary probe so the
+                // range still at least halves every round.
+                diff_t count = last - first;
+                if (count > before / 4 * 3)
+                {
+                    lower_bound_probe_ra(first, count, value, comp);
+                    last = first + count;
+                }
+            }
+
+            return lower_bound_hybrid_impl(Threshold, first, last, value, comp);
+        }
+    }
+
+}
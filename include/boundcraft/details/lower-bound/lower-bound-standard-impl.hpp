@@ -1,7 +1,8 @@
 #pragma once
 
+#include <boundcraft/details/isa.hpp>
 #include <boundcraft/details/lower-bound/lower-bound-util.hpp>
-namespace boundcraft::detail
+namespace boundcraft::inline BOUNDCRAFT_ISA::detail
 {
 
     template <random_it RandomIt, class V, class Comp>
@@ -6,13 +6,15 @@
 #include <iterator>
 #include <type_traits>
 
+#include <boundcraft/details/isa.hpp>
+#include <boundcraft/details/simd/simd-scan.hpp>
 #include <boundcraft/details/util.hpp>
 #include <boundcraft/policy.hpp>
 #include <boundcraft/traits.hpp>
 
 
 
-namespace boundcraft::detail
+namespace boundcraft::inline BOUNDCRAFT_ISA::detail
 {
     
 
@@ -37,6 +39,20 @@ namespace boundcraft::detail
         }
     }
 
+    // One halving step with no data-dependent branch: the base moves by `half` or 0 and the
+    // remaining count only depends on the previous count.
+    template <random_it RandomIt, class V, class Comp>
+    inline void lower_bound_probe_branchless(
+        RandomIt &first,
+        std::iter_difference_t<RandomIt> &count,
+        const V &value,
+        Comp comp)
+    {
+        const auto half = count / 2;
+        first += comp(*(first + half), value) ? half : 0;
+        count -= half;
+    }
+
     template <forward_not_random_it ForwardIt, class V, class Comp>
     inline void lower_bound_probe_fw(ForwardIt &first, std::iter_difference_t<ForwardIt> &count, const V &value, Comp comp)
     {
@@ -59,6 +75,12 @@ namespace boundcraft::detail
     template <class It, class V, class Comp>
     [[nodiscard]] inline It lower_bound_linear_scan(It first, typename std::iterator_traits<It>::difference_type count, const V &value, Comp comp)
     {
+        if constexpr (simd::scan_eligible_v<It, V, Comp>)
+        {
+            constexpr auto op = is_less_comp_v<Comp, V> ? simd::cmp_op::less : simd::cmp_op::greater;
+            return first + simd::count_prefix<op>(std::to_address(first), static_cast<std::size_t>(count), value);
+        }
+
         while (count > 0)
         {
             if (!comp(*first, value))
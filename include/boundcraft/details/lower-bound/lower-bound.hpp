@@ -1,5 +1,9 @@
 #pragma once
 
+#include <boundcraft/details/lower-bound/lower-bound-batch-impl.hpp>
+#include <boundcraft/details/lower-bound/lower-bound-branchless-impl.hpp>
 #include <boundcraft/details/lower-bound/lower-bound-gallop-impl.hpp>
 #include <boundcraft/details/lower-bound/lower-bound-hybrid-impl.hpp>
+#include <boundcraft/details/lower-bound/lower-bound-interpolation-impl.hpp>
+#include <boundcraft/details/lower-bound/lower-bound-prefetch-impl.hpp>
 #include <boundcraft/details/lower-bound/lower-bound-standard-impl.hpp>
\ No newline at end of file
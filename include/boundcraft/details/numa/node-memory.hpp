@@ -0,0 +1,173 @@
+#pragma once
+
+#include <cstddef>
+#include <new>
+#include <utility>
+#include <vector>
+
+#if defined(__linux__)
+#include <sched.h>
+#include <sys/mman.h>
+#endif
+
+#if defined(BOUNDCRAFT_HAS_LIBNUMA)
+#include <numa.h>
+#endif
+
+#include <boundcraft/details/aligned-allocator.hpp>
+#include <boundcraft/details/isa.hpp>
+
+// Node-local storage for replicated_index. With libnuma (BOUNDCRAFT_WITH_NUMA) every memory
+// node gets its own buffer, bound there with mbind before the first write; without it, or on a
+// machine where libnuma reports no NUMA support, there is a single node 0.
+
+namespace boundcraft::inline BOUNDCRAFT_ISA::detail::numa
+{
+
+    // Memory nodes a buffer can be placed on, densely renumbered: slot i is node nodes()[i].
+    inline std::vector<int> nodes()
+    {
+#if defined(BOUNDCRAFT_HAS_LIBNUMA)
+        if (::numa_available() >= 0)
+        {
+            std::vector<int> out;
+            for (int n = 0; n <= ::numa_max_node(); ++n)
+            {
+                if (::numa_bitmask_isbitset(::numa_all_nodes_ptr, static_cast<unsigned>(n)))
+                {
+                    out.push_back(n);
+                }
+            }
+            if (!out.empty())
+            {
+                return out;
+            }
+        }
+#endif
+        return {0};
+    }
+
+    // Slot (index into nodes) of the node each CPU belongs to; empty when there is one node.
+    inline std::vector<std::size_t> cpu_slots(const std::vector<int> &node_ids)
+    {
+        std::vector<std::size_t> out;
+#if defined(BOUNDCRAFT_HAS_LIBNUMA)
+        if (node_ids.size() > 1)
+        {
+            const int cpus = ::numa_num_configured_cpus();
+            out.assign(cpus > 0 ? static_cast<std::size_t>(cpus) : 0, 0);
+            for (std::size_t cpu = 0; cpu < out.size(); ++cpu)
+            {
+                const int node = ::numa_node_of_cpu(static_cast<int>(cpu));
+                for (std::size_t slot = 0; slot < node_ids.size(); ++slot)
+                {
+                    if (node_ids[slot] == node)
+                    {
+                        out[cpu] = slot;
+                    }
+                }
+            }
+        }
+#else
+        (void)node_ids;
+#endif
+        return out;
+    }
+
+    // CPU the calling thread is running on, or -1 if the platform cannot tell.
+    inline int current_cpu() noexcept
+    {
+#if defined(__linux__)
+        return ::sched_getcpu();
+#else
+        return -1;
+#endif
+    }
+
+    // Uninitialised bytes owned on one node. On Linux the buffer is an anonymous mapping, so the
+    // binding and the huge-page advice apply before the pages are first touched; elsewhere it is
+    // a cache-aligned heap block. Placement and huge pages are hints: a kernel that refuses
+    // either still returns usable memory.
+    class node_buffer final
+    {
+    public:
+        node_buffer() = default;
+
+        node_buffer(std::size_t bytes, int node, bool huge_pages) : bytes_(bytes)
+        {
+            if (bytes_ == 0)
+            {
+                return;
+            }
+#if defined(__linux__)
+            void *p = ::mmap(nullptr, bytes_, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (p == MAP_FAILED)
+            {
+                throw std::bad_alloc();
+            }
+            data_ = p;
+#if defined(MADV_HUGEPAGE)
+            if (huge_pages)
+            {
+                ::madvise(data_, bytes_, MADV_HUGEPAGE);
+            }
+#endif
+#if defined(BOUNDCRAFT_HAS_LIBNUMA)
+            if (::numa_available() >= 0)
+            {
+                ::numa_tonode_memory(data_, bytes_, node);
+            }
+#endif
+            (void)node;
+            (void)huge_pages;
+#else
+            (void)node;
+            (void)huge_pages;
+            data_ = ::operator new(bytes_, std::align_val_t{cache_line_bytes});
+#endif
+        }
+
+        node_buffer(const node_buffer &) = delete;
+        node_buffer &operator=(const node_buffer &) = delete;
+
+        node_buffer(node_buffer &&other) noexcept
+            : data_(std::exchange(other.data_, nullptr)), bytes_(std::exchange(other.bytes_, 0))
+        {
+        }
+
+        node_buffer &operator=(node_buffer &&other) noexcept
+        {
+            if (this != &other)
+            {
+                release();
+                data_ = std::exchange(other.data_, nullptr);
+                bytes_ = std::exchange(other.bytes_, 0);
+            }
+            return *this;
+        }
+
+        ~node_buffer() { release(); }
+
+        void *data() const noexcept { return data_; }
+        std::size_t bytes() const noexcept { return bytes_; }
+
+    private:
+        void release() noexcept
+        {
+            if (data_ == nullptr)
+            {
+                return;
+            }
+#if defined(__linux__)
+            ::munmap(data_, bytes_);
+#else
+            ::operator delete(data_, std::align_val_t{cache_line_bytes});
+#endif
+            data_ = nullptr;
+            bytes_ = 0;
+        }
+
+        void *data_ = nullptr;
+        std::size_t bytes_ = 0;
+    };
+}
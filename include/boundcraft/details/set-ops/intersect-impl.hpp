@@ -0,0 +1,78 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+
+#include <boundcraft/details/isa.hpp>
+#include <boundcraft/details/lower-bound/lower-bound-gallop-impl.hpp>
+#include <boundcraft/details/lower-bound/lower-bound-util.hpp>
+
+namespace boundcraft::inline BOUNDCRAFT_ISA::detail
+{
+
+    // Longest stretch handed to the linear skip of the merge: the scan exits at the first
+    // element that is not skipped, so this only caps the work of a single step.
+    inline constexpr std::ptrdiff_t intersect_merge_block = 64;
+
+    // First position in [first, last) not ordered before `value`, searched from `first` by
+    // galloping right: O(log distance) probes from the previous match instead of O(log n) over
+    // the whole remainder.
+    template <class Search_Policy, class RandomIt, class V, class Comp>
+    inline RandomIt gallop_right_to(RandomIt first, RandomIt last, const V &value, Comp comp)
+    {
+        if (first == last || !comp(*first, value))
+        {
+            return first;
+        }
+
+        RandomIt lo = first;
+        RandomIt hi = last;
+        lower_bound_expand_right(lo, hi, first, value, comp);
+        return lower_bound_inner_search<Search_Policy>(lo, hi, value, comp);
+    }
+
+    // Walks the smaller range and gallops through the larger one. `emit` is called with every
+    // element of the intersection (multiset semantics, like std::set_intersection).
+    template <class Search_Policy, class RandomIt, class Comp, class Emit>
+    inline void intersect_gallop_impl(RandomIt small_first, RandomIt small_last,
+                                      RandomIt large_first, RandomIt large_last, Comp comp, Emit emit)
+    {
+        for (; small_first != small_last && large_first != large_last; ++small_first)
+        {
+            large_first = gallop_right_to<Search_Policy>(large_first, large_last, *small_first, comp);
+            if (large_first != large_last && !comp(*small_first, *large_first))
+            {
+                emit(*small_first);
+                ++large_first;
+            }
+        }
+    }
+
+    // Merge for ranges of similar size. Each side skips the run of elements ordered before the
+    // other side's head with lower_bound_linear_scan, which compares a whole register of keys per
+    // step for arithmetic keys (SSE4.2/AVX2) and falls back to a scalar loop otherwise.
+    template <class RandomIt, class Comp, class Emit>
+    inline void intersect_merge_impl(RandomIt a_first, RandomIt a_last,
+                                     RandomIt b_first, RandomIt b_last, Comp comp, Emit emit)
+    {
+        while (a_first != a_last && b_first != b_last)
+        {
+            if (comp(*b_first, *a_first))
+            {
+                b_first = lower_bound_linear_scan(b_first, std::min(b_last - b_first, intersect_merge_block), *a_first, comp);
+            }
+            else if (comp(*a_first, *b_first))
+            {
+                a_first = lower_bound_linear_scan(a_first, std::min(a_last - a_first, intersect_merge_block), *b_first, comp);
+            }
+            else
+            {
+                emit(*a_first);
+                ++a_first;
+                ++b_first;
+            }
+        }
+    }
+
+}
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <numeric>
+#include <span>
+#include <vector>
+
+#include <boundcraft/details/isa.hpp>
+#include <boundcraft/details/set-ops/intersect-impl.hpp>
+
+namespace boundcraft::inline BOUNDCRAFT_ISA::detail
+{
+
+    // Adaptive k-way intersection (the "small adaptive" variant of Demaine, Lopez-Ortiz and
+    // Munro). Candidates are drawn from the smallest list and checked against the others in
+    // increasing size order, each galloping from its own cursor. The first list that overshoots
+    // sends the smallest list galloping past the overshooting value, so runs that cannot match
+    // are skipped in every list at once and the work follows how the lists interleave rather
+    // than their lengths. A value found in all k lists is emitted and consumes one copy from
+    // each (std::set_intersection semantics).
+    template <class Search_Policy, class T, class Comp, class Emit>
+    inline void intersect_k_impl(std::span<const std::span<const T>> lists, Comp comp, Emit emit)
+    {
+        const std::size_t k = lists.size();
+        if (k == 0)
+        {
+            return;
+        }
+
+        std::vector<std::size_t> order(k);
+        std::iota(order.begin(), order.end(), std::size_t{0});
+        std::sort(order.begin(), order.end(), [&](std::size_t a, std::size_t b) { return lists[a].size() < lists[b].size(); });
+
+        std::vector<const T *> pos(k);
+        std::vector<const T *> end(k);
+        for (std::size_t r = 0; r < k; ++r)
+        {
+            const auto &list = lists[order[r]];
+            if (list.empty())
+            {
+                return;
+            }
+            pos[r] = list.data();
+            end[r] = list.data() + list.size();
+        }
+
+        T candidate = *pos[0];
+        std::size_t r = 1;
+
+        for (;;)
+        {
+            if (r == k)
+            {
+                emit(candidate);
+                for (std::size_t i = 0; i < k; ++i)
+                {
+                    if (++pos[i] == end[i])
+                    {
+                        return;
+                    }
+                }
+                candidate = *pos[0];
+                r = 1;
+                continue;
+            }
+
+            pos[r] = gallop_right_to<Search_Policy>(pos[r], end[r], candidate, comp);
+            if (pos[r] == end[r])
+            {
+                return;
+            }
+
+            if (comp(candidate, *pos[r]))
+            {
+                pos[0] = gallop_right_to<Search_Policy>(pos[0], end[0], *pos[r], comp);
+                if (pos[0] == end[0])
+                {
+                    return;
+                }
+                candidate = *pos[0];
+                r = 1;
+            }
+            else
+            {
+                ++r;
+            }
+        }
+    }
+
+}
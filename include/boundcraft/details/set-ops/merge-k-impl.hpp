@@ -0,0 +1,137 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <span>
+#include <vector>
+
+#include <boundcraft/details/isa.hpp>
+#include <boundcraft/details/upper-bound/upper-bound-gallop-impl.hpp>
+
+namespace boundcraft::inline BOUNDCRAFT_ISA::detail
+{
+
+    // Cursors of the non-exhausted lists, kept as a binary heap on their current head so the
+    // smallest head is at heap_.front().
+    template <class T, class Comp>
+    class merge_heads final
+    {
+    public:
+        struct cursor
+        {
+            const T *pos;
+            const T *end;
+        };
+
+        merge_heads(std::span<const std::span<const T>> lists, Comp comp) : comp_(comp)
+        {
+            heap_.reserve(lists.size());
+            for (const auto &list : lists)
+            {
+                if (!list.empty())
+                {
+                    heap_.push_back({list.data(), list.data() + list.size()});
+                }
+            }
+            std::make_heap(heap_.begin(), heap_.end(), later());
+        }
+
+        bool empty() const noexcept { return heap_.empty(); }
+        std::size_t size() const noexcept { return heap_.size(); }
+        const T &top() const { return *heap_.front().pos; }
+
+        cursor pop()
+        {
+            std::pop_heap(heap_.begin(), heap_.end(), later());
+            const cursor c = heap_.back();
+            heap_.pop_back();
+            return c;
+        }
+
+        void push(cursor c)
+        {
+            if (c.pos != c.end)
+            {
+                heap_.push_back(c);
+                std::push_heap(heap_.begin(), heap_.end(), later());
+            }
+        }
+
+    private:
+        auto later() const
+        {
+            return [comp = comp_](const cursor &a, const cursor &b) { return comp(*b.pos, *a.pos); };
+        }
+
+        Comp comp_;
+        std::vector<cursor> heap_;
+    };
+
+    // Every element of every list in order. After taking the smallest head, its list keeps
+    // supplying output for as long as it stays at or below the next smallest head, so lists that
+    // do not interleave are copied in runs.
+    template <class T, class Comp, class Emit>
+    inline void merge_k_impl(std::span<const std::span<const T>> lists, Comp comp, Emit emit)
+    {
+        merge_heads<T, Comp> heads(lists, comp);
+
+        while (!heads.empty())
+        {
+            auto c = heads.pop();
+            if (heads.empty())
+            {
+                for (; c.pos != c.end; ++c.pos)
+                {
+                    emit(*c.pos);
+                }
+                return;
+            }
+
+            const T &bound = heads.top();
+            do
+            {
+                emit(*c.pos);
+                ++c.pos;
+            } while (c.pos != c.end && !comp(bound, *c.pos));
+            heads.push(c);
+        }
+    }
+
+    // Each value as many times as the list holding the most copies of it (std::set_union
+    // semantics generalised to k lists). Runs of equal keys are skipped by galloping.
+    template <class Search_Policy, class T, class Comp, class Emit>
+    inline void union_k_impl(std::span<const std::span<const T>> lists, Comp comp, Emit emit)
+    {
+        using cursor = typename merge_heads<T, Comp>::cursor;
+
+        merge_heads<T, Comp> heads(lists, comp);
+        std::vector<cursor> advanced;
+        advanced.reserve(heads.size());
+
+        while (!heads.empty())
+        {
+            const T value = heads.top();
+            std::size_t copies = 0;
+
+            while (!heads.empty() && !comp(value, heads.top()))
+            {
+                cursor c = heads.pop();
+                const T *run_end = upper_bound_gallop_from<Search_Policy>(c.pos, c.end, c.pos, value, comp);
+                copies = std::max(copies, static_cast<std::size_t>(run_end - c.pos));
+                c.pos = run_end;
+                advanced.push_back(c);
+            }
+
+            for (std::size_t i = 0; i < copies; ++i)
+            {
+                emit(value);
+            }
+            for (const cursor &c : advanced)
+            {
+                heads.push(c);
+            }
+            advanced.clear();
+        }
+    }
+
+}
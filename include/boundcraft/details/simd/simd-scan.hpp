@@ -0,0 +1,354 @@
+#pragma once
+
+#include <bit>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+
+#if defined(__AVX2__) || defined(__SSE4_2__)
+#include <immintrin.h>
+#endif
+
+#include <boundcraft/details/isa.hpp>
+#include <boundcraft/details/util.hpp>
+
+// Vectorised compare-and-count kernels: prefix scans for the linear phase of the hybrid
+// policy and whole-node counts for the layout indexes.
+// AVX2 is preferred when the translation unit is compiled for it, SSE4.2 otherwise.
+// Without either, `enabled` is false and callers keep their scalar loops.
+// Like the rest of the library the kernels are tagged with the instruction set (details/isa.hpp),
+// so they and every search that inlines them are distinct symbols per -m flag set.
+
+namespace boundcraft::inline BOUNDCRAFT_ISA::detail::simd
+{
+
+    // The relation `elem OP value` that must hold for an element to be skipped.
+    enum class cmp_op
+    {
+        less,
+        less_equal,
+        greater,
+        greater_equal
+    };
+
+    template <cmp_op Op, class T>
+    [[nodiscard]] inline bool holds(const T &elem, const T &value)
+    {
+        if constexpr (Op == cmp_op::less)
+            return elem < value;
+        else if constexpr (Op == cmp_op::less_equal)
+            return !(value < elem);
+        else if constexpr (Op == cmp_op::greater)
+            return value < elem;
+        else
+            return !(elem < value);
+    }
+
+#if defined(__AVX2__)
+    inline constexpr bool enabled = true;
+    inline constexpr std::size_t register_bytes = 32;
+#elif defined(__SSE4_2__)
+    inline constexpr bool enabled = true;
+    inline constexpr std::size_t register_bytes = 16;
+#else
+    inline constexpr bool enabled = false;
+    inline constexpr std::size_t register_bytes = 0;
+#endif
+
+    template <class T>
+    struct kernel;
+
+#if defined(__AVX2__)
+
+    template <class T>
+        requires(std::is_integral_v<T> && (sizeof(T) == 4 || sizeof(T) == 8))
+    struct kernel<T>
+    {
+        using vec = __m256i;
+        static constexpr std::size_t lanes = 32 / sizeof(T);
+
+        static vec bias(vec x)
+        {
+            if constexpr (std::is_signed_v<T>)
+                return x;
+            else if constexpr (sizeof(T) == 4)
+                return _mm256_xor_si256(x, _mm256_set1_epi32(INT32_MIN));
+            else
+                return _mm256_xor_si256(x, _mm256_set1_epi64x(INT64_MIN));
+        }
+
+        static vec broadcast(T value)
+        {
+            if constexpr (sizeof(T) == 4)
+                return bias(_mm256_set1_epi32(static_cast<std::int32_t>(value)));
+            else
+                return bias(_mm256_set1_epi64x(static_cast<std::int64_t>(value)));
+        }
+
+        static vec gt(vec a, vec b)
+        {
+            if constexpr (sizeof(T) == 4)
+                return _mm256_cmpgt_epi32(a, b);
+            else
+                return _mm256_cmpgt_epi64(a, b);
+        }
+
+        static unsigned movemask(vec m)
+        {
+            if constexpr (sizeof(T) == 4)
+                return static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(m)));
+            else
+                return static_cast<unsigned>(_mm256_movemask_pd(_mm256_castsi256_pd(m)));
+        }
+
+        template <cmp_op Op>
+        static unsigned mask(const T *p, vec v)
+        {
+            constexpr unsigned full = (1u << lanes) - 1u;
+            const vec e = bias(_mm256_loadu_si256(reinterpret_cast<const vec *>(p)));
+
+            if constexpr (Op == cmp_op::less)
+                return movemask(gt(v, e));
+            else if constexpr (Op == cmp_op::greater)
+                return movemask(gt(e, v));
+            else if constexpr (Op == cmp_op::less_equal)
+                return ~movemask(gt(e, v)) & full;
+            else
+                return ~movemask(gt(v, e)) & full;
+        }
+    };
+
+    template <>
+    struct kernel<float>
+    {
+        using vec = __m256;
+        static constexpr std::size_t lanes = 8;
+
+        static vec broadcast(float value) { return _mm256_set1_ps(value); }
+
+        template <cmp_op Op>
+        static unsigned mask(const float *p, vec v)
+        {
+            const vec e = _mm256_loadu_ps(p);
+
+            if constexpr (Op == cmp_op::less)
+                return static_cast<unsigned>(_mm256_movemask_ps(_mm256_cmp_ps(e, v, _CMP_LT_OQ)));
+            else if constexpr (Op == cmp_op::less_equal)
+                return static_cast<unsigned>(_mm256_movemask_ps(_mm256_cmp_ps(e, v, _CMP_LE_OQ)));
+            else if constexpr (Op == cmp_op::greater)
+                return static_cast<unsigned>(_mm256_movemask_ps(_mm256_cmp_ps(e, v, _CMP_GT_OQ)));
+            else
+                return static_cast<unsigned>(_mm256_movemask_ps(_mm256_cmp_ps(e, v, _CMP_GE_OQ)));
+        }
+    };
+
+    template <>
+    struct kernel<double>
+    {
+        using vec = __m256d;
+        static constexpr std::size_t lanes = 4;
+
+        static vec broadcast(double value) { return _mm256_set1_pd(value); }
+
+        template <cmp_op Op>
+        static unsigned mask(const double *p, vec v)
+        {
+            const vec e = _mm256_loadu_pd(p);
+
+            if constexpr (Op == cmp_op::less)
+                return static_cast<unsigned>(_mm256_movemask_pd(_mm256_cmp_pd(e, v, _CMP_LT_OQ)));
+            else if constexpr (Op == cmp_op::less_equal)
+                return static_cast<unsigned>(_mm256_movemask_pd(_mm256_cmp_pd(e, v, _CMP_LE_OQ)));
+            else if constexpr (Op == cmp_op::greater)
+                return static_cast<unsigned>(_mm256_movemask_pd(_mm256_cmp_pd(e, v, _CMP_GT_OQ)));
+            else
+                return static_cast<unsigned>(_mm256_movemask_pd(_mm256_cmp_pd(e, v, _CMP_GE_OQ)));
+        }
+    };
+
+#elif defined(__SSE4_2__)
+
+    template <class T>
+        requires(std::is_integral_v<T> && (sizeof(T) == 4 || sizeof(T) == 8))
+    struct kernel<T>
+    {
+        using vec = __m128i;
+        static constexpr std::size_t lanes = 16 / sizeof(T);
+
+        static vec bias(vec x)
+        {
+            if constexpr (std::is_signed_v<T>)
+                return x;
+            else if constexpr (sizeof(T) == 4)
+                return _mm_xor_si128(x, _mm_set1_epi32(INT32_MIN));
+            else
+                return _mm_xor_si128(x, _mm_set1_epi64x(INT64_MIN));
+        }
+
+        static vec broadcast(T value)
+        {
+            if constexpr (sizeof(T) == 4)
+                return bias(_mm_set1_epi32(static_cast<std::int32_t>(value)));
+            else
+                return bias(_mm_set1_epi64x(static_cast<std::int64_t>(value)));
+        }
+
+        static vec gt(vec a, vec b)
+        {
+            if constexpr (sizeof(T) == 4)
+                return _mm_cmpgt_epi32(a, b);
+            else
+                return _mm_cmpgt_epi64(a, b);
+        }
+
+        static unsigned movemask(vec m)
+        {
+            if constexpr (sizeof(T) == 4)
+                return static_cast<unsigned>(_mm_movemask_ps(_mm_castsi128_ps(m)));
+            else
+                return static_cast<unsigned>(_mm_movemask_pd(_mm_castsi128_pd(m)));
+        }
+
+        template <cmp_op Op>
+        static unsigned mask(const T *p, vec v)
+        {
+            constexpr unsigned full = (1u << lanes) - 1u;
+            const vec e = bias(_mm_loadu_si128(reinterpret_cast<const vec *>(p)));
+
+            if constexpr (Op == cmp_op::less)
+                return movemask(gt(v, e));
+            else if constexpr (Op == cmp_op::greater)
+                return movemask(gt(e, v));
+            else if constexpr (Op == cmp_op::less_equal)
+                return ~movemask(gt(e, v)) & full;
+            else
+                return ~movemask(gt(v, e)) & full;
+        }
+    };
+
+    template <>
+    struct kernel<float>
+    {
+        using vec = __m128;
+        static constexpr std::size_t lanes = 4;
+
+        static vec broadcast(float value) { return _mm_set1_ps(value); }
+
+        template <cmp_op Op>
+        static unsigned mask(const float *p, vec v)
+        {
+            const vec e = _mm_loadu_ps(p);
+
+            if constexpr (Op == cmp_op::less)
+                return static_cast<unsigned>(_mm_movemask_ps(_mm_cmplt_ps(e, v)));
+            else if constexpr (Op == cmp_op::less_equal)
+                return static_cast<unsigned>(_mm_movemask_ps(_mm_cmple_ps(e, v)));
+            else if constexpr (Op == cmp_op::greater)
+                return static_cast<unsigned>(_mm_movemask_ps(_mm_cmpgt_ps(e, v)));
+            else
+                return static_cast<unsigned>(_mm_movemask_ps(_mm_cmpge_ps(e, v)));
+        }
+    };
+
+    template <>
+    struct kernel<double>
+    {
+        using vec = __m128d;
+        static constexpr std::size_t lanes = 2;
+
+        static vec broadcast(double value) { return _mm_set1_pd(value); }
+
+        template <cmp_op Op>
+        static unsigned mask(const double *p, vec v)
+        {
+            const vec e = _mm_loadu_pd(p);
+
+            if constexpr (Op == cmp_op::less)
+                return static_cast<unsigned>(_mm_movemask_pd(_mm_cmplt_pd(e, v)));
+            else if constexpr (Op == cmp_op::less_equal)
+                return static_cast<unsigned>(_mm_movemask_pd(_mm_cmple_pd(e, v)));
+            else if constexpr (Op == cmp_op::greater)
+                return static_cast<unsigned>(_mm_movemask_pd(_mm_cmpgt_pd(e, v)));
+            else
+                return static_cast<unsigned>(_mm_movemask_pd(_mm_cmpge_pd(e, v)));
+        }
+    };
+
+#endif
+
+    template <class T>
+    inline constexpr bool is_key_v =
+        enabled &&
+        ((std::is_integral_v<T> && !std::is_same_v<T, bool> && (sizeof(T) == 4 || sizeof(T) == 8)) ||
+         std::is_same_v<T, float> || std::is_same_v<T, double>);
+
+    // The scan reads the keys straight from memory, so the iterator must be contiguous and the
+    // searched value must already have the element type (no silent narrowing or promotion).
+    template <class It, class V, class Comp>
+    inline constexpr bool scan_eligible_v =
+        std::contiguous_iterator<It> &&
+        std::is_same_v<std::remove_cv_t<std::iter_value_t<It>>, std::remove_cv_t<V>> &&
+        is_key_v<std::remove_cv_t<V>> &&
+        (is_less_comp_v<Comp, std::remove_cv_t<V>> || is_greater_comp_v<Comp, std::remove_cv_t<V>>);
+
+    // Length of the longest prefix of [p, p + n) whose elements satisfy `elem OP value`.
+    // On sorted input that prefix is exactly the elements a lower/upper bound skips over.
+    template <cmp_op Op, class T>
+        requires is_key_v<T>
+    [[nodiscard]] inline std::size_t count_prefix(const T *p, std::size_t n, T value)
+    {
+        using k = kernel<T>;
+        constexpr unsigned full = (1u << k::lanes) - 1u;
+
+        const auto v = k::broadcast(value);
+
+        std::size_t i = 0;
+        for (; i + k::lanes <= n; i += k::lanes)
+        {
+            const unsigned m = k::template mask<Op>(p + i, v);
+            if (m != full)
+            {
+                return i + static_cast<std::size_t>(std::countr_one(m));
+            }
+        }
+
+        for (; i < n; ++i)
+        {
+            if (!holds<Op>(p[i], value))
+            {
+                break;
+            }
+        }
+        return i;
+    }
+
+    // Number of elements of [p, p + n) satisfying `elem OP value`, without early exit. Used where
+    // n is a small compile-time node width and a fixed instruction sequence beats the branch.
+    template <cmp_op Op, class T>
+    [[nodiscard]] inline std::size_t count_matching(const T *p, std::size_t n, T value)
+    {
+        std::size_t i = 0;
+        std::size_t total = 0;
+
+        if constexpr (is_key_v<T>)
+        {
+            using k = kernel<T>;
+            const auto v = k::broadcast(value);
+
+            for (; i + k::lanes <= n; i += k::lanes)
+            {
+                total += static_cast<std::size_t>(std::popcount(k::template mask<Op>(p + i, v)));
+            }
+        }
+
+        for (; i < n; ++i)
+        {
+            total += static_cast<std::size_t>(holds<Op>(p[i], value));
+        }
+        return total;
+    }
+
+}
@@ -0,0 +1,143 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <span>
+
+#include <boundcraft/details/isa.hpp>
+#include <boundcraft/details/lower-bound/lower-bound-batch-impl.hpp>
+#include <boundcraft/details/upper-bound/upper-bound-gallop-impl.hpp>
+#include <boundcraft/details/upper-bound/upper-bound-util.hpp>
+
+namespace boundcraft::inline BOUNDCRAFT_ISA::detail
+{
+
+    // Upper-bound twin of lower_bound_batch_impl.
+    template <class Policy, random_it RandomIt, class V, class Comp>
+    inline void upper_bound_batch_impl(RandomIt first, RandomIt last, std::span<const V> keys, std::span<RandomIt> out, Comp comp)
+    {
+        using diff_t = typename std::iterator_traits<RandomIt>::difference_type;
+        using traits = boundcraft::policy::traits::policy_traits<Policy>;
+        constexpr auto k = traits::kind;
+
+        const diff_t n = last - first;
+
+        if (n == 0)
+        {
+            std::fill(out.begin(), out.begin() + keys.size(), first);
+            return;
+        }
+
+        constexpr diff_t limit = [] {
+            if constexpr (k == policy_kind::hybrid)
+                return static_cast<diff_t>(boundcraft::policy::traits::hybrid_threshold_v<Policy, std::iter_value_t<RandomIt>>);
+            else if constexpr (k == policy_kind::branchless)
+                return diff_t{1};
+            else
+                return diff_t{0};
+        }();
+
+        std::array<RandomIt, batch_group_size> lo;
+        std::array<diff_t, batch_group_size> count;
+
+        for (std::size_t base = 0; base < keys.size(); base += batch_group_size)
+        {
+            const std::size_t m = std::min(batch_group_size, keys.size() - base);
+            const V *group = keys.data() + base;
+
+            for (std::size_t i = 0; i < m; ++i)
+            {
+                lo[i] = first;
+                count[i] = n;
+            }
+            prefetch(first + n / 2);
+
+            bool active = n > limit;
+            while (active)
+            {
+                active = false;
+                for (std::size_t i = 0; i < m; ++i)
+                {
+                    if (count[i] > limit)
+                    {
+                        if constexpr (k == policy_kind::branchless)
+                            upper_bound_probe_branchless(lo[i], count[i], group[i], comp);
+                        else
+                            upper_bound_probe_ra(lo[i], count[i], group[i], comp);
+
+                        prefetch(lo[i] + count[i] / 2);
+                        active |= count[i] > limit;
+                    }
+                }
+            }
+
+            for (std::size_t i = 0; i < m; ++i)
+            {
+                if constexpr (k == policy_kind::hybrid)
+                    out[base + i] = upper_bound_linear_scan(lo[i], count[i], group[i], comp);
+                else if constexpr (k == policy_kind::branchless)
+                    out[base + i] = lo[i] + static_cast<diff_t>(!comp(group[i], *lo[i]));
+                else
+                    out[base + i] = lo[i];
+            }
+        }
+    }
+
+    // Upper-bound twin of lower_bound_ascending_batch_impl.
+    template <class Search_Policy, random_it RandomIt, class V, class Comp>
+    inline void upper_bound_ascending_batch_impl(RandomIt first, RandomIt last, std::span<const V> keys, std::span<RandomIt> out, Comp comp)
+    {
+        RandomIt prev = first;
+
+        for (std::size_t i = 0; i < keys.size(); ++i)
+        {
+            const V &key = keys[i];
+
+            if (prev == last || comp(key, *prev))
+            {
+                out[i] = prev;
+                continue;
+            }
+
+            RandomIt lo = prev;
+            RandomIt hi = last;
+            upper_bound_expand_right(lo, hi, prev, key, comp);
+
+            prev = upper_bound_inner_search<Search_Policy>(lo, hi, key, comp);
+            out[i] = prev;
+        }
+    }
+
+    template <class Search_Policy, random_it RandomIt, class V, class Comp>
+    inline void upper_bound_descending_batch_impl(RandomIt first, RandomIt last, std::span<const V> keys, std::span<RandomIt> out, Comp comp)
+    {
+        RandomIt prev = last;
+
+        for (std::size_t i = 0; i < keys.size(); ++i)
+        {
+            const V &key = keys[i];
+
+            if (prev == first)
+            {
+                out[i] = prev;
+                continue;
+            }
+
+            const RandomIt start_point = prev - 1;
+            if (!comp(key, *start_point))
+            {
+                out[i] = prev;
+                continue;
+            }
+
+            RandomIt lo = first;
+            RandomIt hi = prev;
+            upper_bound_expand_left(lo, hi, start_point, key, comp);
+
+            prev = upper_bound_inner_search<Search_Policy>(lo, hi, key, comp);
+            out[i] = prev;
+        }
+    }
+
+}
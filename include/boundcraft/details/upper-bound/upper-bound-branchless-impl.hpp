@@ -0,0 +1,39 @@
+#pragma once
+
+#include <boundcraft/details/isa.hpp>
+#include <boundcraft/details/upper-bound/upper-bound-util.hpp>
+
+namespace boundcraft::inline BOUNDCRAFT_ISA::detail
+{
+
+    template <class It, class V, class Comp>
+        requires(!std::random_access_iterator<It>)
+    It upper_bound_branchless_impl(It, It, const V &, Comp)
+    {
+        static_assert(always_false_v<It>,
+                      "Boundcraft: branchless upper_bound requires RANDOM-ACCESS iterators "
+                      "(e.g. std::vector, std::span, pointers). "
+                      "Use standard_binary/hybrid for forward iterators (e.g. std::forward_list).");
+        return It{};
+    }
+
+    template <random_it RandomIt, class V, class Comp>
+    inline RandomIt upper_bound_branchless_impl(
+        RandomIt first, RandomIt last, const V &value, Comp comp)
+    {
+        using diff_t = typename std::iterator_traits<RandomIt>::difference_type;
+
+        diff_t count = last - first;
+        if (count == 0)
+        {
+            return first;
+        }
+
+        while (count > 1)
+        {
+            upper_bound_probe_branchless(first, count, value, comp);
+        }
+        return first + static_cast<diff_t>(!comp(value, *first));
+    }
+
+}
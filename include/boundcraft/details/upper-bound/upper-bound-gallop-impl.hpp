@@ -1,14 +1,88 @@
 #pragma once
 
+#include <boundcraft/details/adaptive/adaptive-fwd.hpp>
+#include <boundcraft/details/isa.hpp>
+#include <boundcraft/details/upper-bound/upper-bound-branchless-impl.hpp>
 #include <boundcraft/details/upper-bound/upper-bound-hybrid-impl.hpp>
+#include <boundcraft/details/upper-bound/upper-bound-interpolation-impl.hpp>
+#include <boundcraft/details/upper-bound/upper-bound-prefetch-impl.hpp>
 #include <boundcraft/details/upper-bound/upper-bound-standard-impl.hpp>
 #include <boundcraft/details/upper-bound/upper-bound-util.hpp>
 
-namespace boundcraft::detail
+namespace boundcraft::inline BOUNDCRAFT_ISA::detail
 {
 
 
 
+    template <class Search_Policy, class RandomIt, class V, class Comp>
+    inline RandomIt upper_bound_inner_search(RandomIt first, RandomIt last, const V &value, Comp comp)
+    {
+        using ptraits = boundcraft::policy::traits::policy_traits<Search_Policy>;
+        constexpr auto kind = ptraits::kind;
+
+        if constexpr (kind == policy_kind::standard_binary)
+        {
+            return boundcraft::detail::upper_bound_standard_binary_impl(first, last, value, comp);
+        }
+        else if constexpr (kind == policy_kind::branchless)
+        {
+            return boundcraft::detail::upper_bound_branchless_impl(first, last, value, comp);
+        }
+        else if constexpr (kind == policy_kind::prefetch_binary)
+        {
+            return boundcraft::detail::upper_bound_prefetch_binary_impl<ptraits::levels>(first, last, value, comp);
+        }
+        else if constexpr (kind == policy_kind::hybrid)
+        {
+            constexpr std::size_t threshold = boundcraft::policy::traits::hybrid_threshold_v<Search_Policy, std::iter_value_t<RandomIt>>;
+            return boundcraft::detail::upper_bound_hybrid_impl(threshold, first, last, value, comp);
+        }
+        else if constexpr (kind == policy_kind::interpolation)
+        {
+            return boundcraft::detail::upper_bound_interpolation_impl<ptraits::max_probes, ptraits::threshold>(
+                first, last, value, comp);
+        }
+        else if constexpr (kind == policy_kind::adaptive)
+        {
+            // The bracket gets the calibrated kernel for its own length, which for short brackets
+            // is usually a hybrid or branchless one rather than the whole range's choice.
+            return boundcraft::detail::upper_bound_adaptive_impl(first, last, value, comp);
+        }
+        else
+        {
+            static_assert([]
+                          { return false; }(), "Unknown policy");
+        }
+    }
+
+    // Gallops outward from `start_point` (which must lie in [first, last)) and finishes with
+    // Search_Policy inside the bracket. Cost is O(log distance) to the answer.
+    template <class Search_Policy, class RandomIt, class V, class Comp>
+    inline RandomIt upper_bound_gallop_from(RandomIt first, RandomIt last, RandomIt start_point, const V &value, Comp comp)
+    {
+        RandomIt lo = first;
+        RandomIt hi = last;
+
+        if (!comp(value, *start_point))
+        {
+            if (start_point == last - 1)
+            {
+                return last;
+            }
+            upper_bound_expand_right(lo, hi, start_point, value, comp);
+        }
+        else
+        {
+            if (start_point == first)
+            {
+                return first;
+            }
+            upper_bound_expand_left(lo, hi, start_point, value, comp);
+        }
+
+        return upper_bound_inner_search<Search_Policy>(lo, hi, value, comp);
+    }
+
     template <class Search_Policy, class Gallop_Start, class It, class V, class Comp>
         requires(!std::random_access_iterator<It>)
     It upper_bound_gallop_impl(It, It, const V &, Comp)
@@ -68,43 +142,7 @@ namespace boundcraft::detail
                           { return false; }(), "Unknown gallop policy");
         }
 
-        It lo = first;
-        It hi = last;
-
-        if (comp(value, *start_point))
-        {
-            if (start_point == last - 1)
-            {
-                return last;
-            }
-            upper_bound_expand_right(lo, hi, start_point, value, comp);
-        }
-        else
-        {
-            if (start_point == first)
-            {
-                return first;
-            }
-            upper_bound_expand_left(lo, hi, start_point, value, comp);
-        }
-
-        using ptraits = boundcraft::policy::traits::policy_traits<Search_Policy>;
-        constexpr auto kind = ptraits::kind;
-
-        if constexpr (kind == policy_kind::standard_binary)
-        {
-            return boundcraft::detail::upper_bound_standard_binary_impl(lo, hi, value, comp);
-        }
-        else if constexpr (kind == policy_kind::hybrid)
-        {
-            constexpr std::size_t threshold = ptraits::threshold;
-            return boundcraft::detail::upper_bound_hybrid_impl(threshold, lo, hi, value, comp);
-        }
-        else
-        {
-            static_assert([]
-                          { return false; }(), "Unknown policy");
-        }
+        return upper_bound_gallop_from<Search_Policy>(first, last, start_point, value, comp);
     }
 }
 
@@ -1,8 +1,9 @@
 #pragma once
 
-#include <boundcraft/details/lower-bound/lower-bound-util.hpp>
+#include <boundcraft/details/isa.hpp>
+#include <boundcraft/details/upper-bound/upper-bound-util.hpp>
 
-namespace boundcraft::detail
+namespace boundcraft::inline BOUNDCRAFT_ISA::detail
 {
 
     template <random_it RandomIt, class V, class Comp>
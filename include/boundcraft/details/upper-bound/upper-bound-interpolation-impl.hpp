@@ -0,0 +1,61 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+
+#include <boundcraft/details/isa.hpp>
+#include <boundcraft/details/lower-bound/lower-bound-interpolation-impl.hpp>
+#include <boundcraft/details/upper-bound/upper-bound-hybrid-impl.hpp>
+#include <boundcraft/details/upper-bound/upper-bound-util.hpp>
+
+namespace boundcraft::inline BOUNDCRAFT_ISA::detail
+{
+
+    template <std::size_t Max_Probes, std::size_t Threshold, class It, class V, class Comp>
+    inline It upper_bound_interpolation_impl(It first, It last, const V &value, Comp comp)
+    {
+        if constexpr (!interpolation_eligible_v<It, V, Comp>)
+        {
+            return upper_bound_hybrid_impl(Threshold, first, last, value, comp);
+        }
+        else
+        {
+            using diff_t = typename std::iterator_traits<It>::difference_type;
+
+            for (std::size_t probe = 0; probe < Max_Probes && last - first > static_cast<diff_t>(Threshold); ++probe)
+            {
+                if (comp(value, *first))
+                {
+                    return first;
+                }
+                if (!comp(value, *(last - 1)))
+                {
+                    return last;
+                }
+
+                // *first <= value < *(last - 1), so the answer lies in (first, last - 1].
+                const diff_t before = last - first;
+                const It mid = interpolation_probe_point(first, last, interpolation_fraction(*first, *(last - 1), value));
+
+                if (!comp(value, *mid))
+                {
+                    first = mid + 1;
+                }
+                else
+                {
+                    last = mid;
+                }
+
+                diff_t count = last - first;
+                if (count > before / 4 * 3)
+                {
+                    upper_bound_probe_ra(first, count, value, comp);
+                    last = first + count;
+                }
+            }
+
+            return upper_bound_hybrid_impl(Threshold, first, last, value, comp);
+        }
+    }
+
+}
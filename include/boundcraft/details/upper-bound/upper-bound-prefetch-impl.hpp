@@ -0,0 +1,42 @@
+#pragma once
+
+#include <boundcraft/details/isa.hpp>
+#include <boundcraft/details/upper-bound/upper-bound-standard-impl.hpp>
+#include <boundcraft/details/upper-bound/upper-bound-util.hpp>
+
+namespace boundcraft::inline BOUNDCRAFT_ISA::detail
+{
+
+    // Branchless halving search that, before each compare, prefetches every probe it can make
+    // Levels steps later (the two next probes for Levels == 1). The probe order does not depend
+    // on the outcome until the select, so the misses of the next Levels steps are in flight
+    // while this one resolves.
+    template <std::size_t Levels, random_it RandomIt, class V, class Comp>
+    inline RandomIt upper_bound_prefetch_binary_impl(
+        RandomIt first, RandomIt last, const V &value, Comp comp)
+    {
+        using diff_t = typename std::iterator_traits<RandomIt>::difference_type;
+
+        diff_t count = last - first;
+        if (count == 0)
+        {
+            return first;
+        }
+
+        while (count > 1)
+        {
+            prefetch_next_midpoints<Levels>(first, count);
+            upper_bound_probe_branchless(first, count, value, comp);
+        }
+        return first + static_cast<diff_t>(!comp(value, *first));
+    }
+
+    // Forward iterators have no address to prefetch ahead of the walk.
+    template <std::size_t Levels, forward_not_random_it ForwardIt, class V, class Comp>
+    inline ForwardIt upper_bound_prefetch_binary_impl(
+        ForwardIt first, ForwardIt last, const V &value, Comp comp)
+    {
+        return upper_bound_standard_binary_impl(first, last, value, comp);
+    }
+
+}
@@ -4,13 +4,15 @@
 #include <iterator>
 #include <type_traits>
 
+#include <boundcraft/details/isa.hpp>
+#include <boundcraft/details/simd/simd-scan.hpp>
 #include <boundcraft/details/util.hpp>
 #include <boundcraft/policy.hpp>
 #include <boundcraft/traits.hpp>
 
 
 
-namespace boundcraft::detail
+namespace boundcraft::inline BOUNDCRAFT_ISA::detail
 {
 
     template <random_it RandomIt, class V, class Comp>
@@ -34,6 +36,18 @@ namespace boundcraft::detail
         }
     }
 
+    template <random_it RandomIt, class V, class Comp>
+    inline void upper_bound_probe_branchless(
+        RandomIt &first,
+        std::iter_difference_t<RandomIt> &count,
+        const V &value,
+        Comp comp)
+    {
+        const auto half = count / 2;
+        first += comp(value, *(first + half)) ? 0 : half;
+        count -= half;
+    }
+
     template <forward_not_random_it ForwardIt, class V, class Comp>
     inline void upper_bound_probe_fw(ForwardIt &first, std::iter_difference_t<ForwardIt> &count, const V &value, Comp comp)
     {
@@ -56,9 +70,15 @@ namespace boundcraft::detail
     template <class It, class V, class Comp>
     [[nodiscard]] inline It upper_bound_linear_scan(It first, typename std::iterator_traits<It>::difference_type count, const V &value, Comp comp)
     {
+        if constexpr (simd::scan_eligible_v<It, V, Comp>)
+        {
+            constexpr auto op = is_less_comp_v<Comp, V> ? simd::cmp_op::less_equal : simd::cmp_op::greater_equal;
+            return first + simd::count_prefix<op>(std::to_address(first), static_cast<std::size_t>(count), value);
+        }
+
         while (count > 0)
         {
-            if (!comp(value, *first))
+            if (comp(value, *first))
             {
                 break;
             }
@@ -77,7 +97,7 @@ namespace boundcraft::detail
         diff_t low = 0;
         diff_t high = 1;
 
-        while (high < avail_right && comp(value, *(start_point + high)))
+        while (high < avail_right && !comp(value, *(start_point + high)))
         {
             low = high;
             high *= 2;
@@ -99,7 +119,7 @@ namespace boundcraft::detail
         diff_t low = 0;
         diff_t high = 1;
 
-        while (high <= avail_left && !comp(value, *(start_point - high)))
+        while (high <= avail_left && comp(value, *(start_point - high)))
         {
             low = high;
             high *= 2;
@@ -1,5 +1,9 @@
 #pragma once
 
+#include <boundcraft/details/upper-bound/upper-bound-batch-impl.hpp>
+#include <boundcraft/details/upper-bound/upper-bound-branchless-impl.hpp>
 #include <boundcraft/details/upper-bound/upper-bound-gallop-impl.hpp>
 #include <boundcraft/details/upper-bound/upper-bound-hybrid-impl.hpp>
+#include <boundcraft/details/upper-bound/upper-bound-interpolation-impl.hpp>
+#include <boundcraft/details/upper-bound/upper-bound-prefetch-impl.hpp>
 #include <boundcraft/details/upper-bound/upper-bound-standard-impl.hpp>
\ No newline at end of file
@@ -1,9 +1,15 @@
 #pragma once
 
 #include <concepts>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <type_traits>
 
+#include <boundcraft/details/isa.hpp>
 
-namespace boundcraft::detail{
+namespace boundcraft::inline BOUNDCRAFT_ISA::detail{
 
     template <class...>
     inline constexpr bool always_false_v = false;
@@ -16,4 +22,54 @@ namespace boundcraft::detail{
 
     template <class It>
     concept forward_not_random_it = std::forward_iterator<It> && (!std::random_access_iterator<It>);
-}
\ No newline at end of file
+
+    template <class Comp, class T>
+    inline constexpr bool is_less_comp_v = std::is_same_v<Comp, std::less<>> || std::is_same_v<Comp, std::less<T>>;
+
+    template <class Comp, class T>
+    inline constexpr bool is_greater_comp_v = std::is_same_v<Comp, std::greater<>> || std::is_same_v<Comp, std::greater<T>>;
+
+    // Hint that *it will be read soon. Only contiguous iterators are prefetched; for anything
+    // else the address of the element is not known without dereferencing.
+    // The prefetch helpers are forced inline: GCC counts a prefetch as no side effect, so a void
+    // function made only of prefetches is deduced const and calls it did not inline are deleted.
+    template <class It>
+    [[gnu::always_inline]] inline void prefetch(It it) noexcept
+    {
+        if constexpr (std::contiguous_iterator<It>)
+        {
+#if defined(__GNUC__) || defined(__clang__)
+            __builtin_prefetch(std::to_address(it));
+#else
+            (void)it;
+#endif
+        }
+        else
+        {
+            (void)it;
+        }
+    }
+
+    // Prefetches every element the halving probe Levels steps ahead over [first, first + count)
+    // can read (2^Levels addresses). The next probe is at first + rest / 2 or first + half +
+    // rest / 2 (half = count / 2, rest = count - half), and each of those ranges splits the same
+    // way. Only that deepest level is issued: in a loop calling this once per step, the probes
+    // 1..Levels-1 steps ahead were the deepest level of earlier calls, except during the first
+    // Levels - 1 steps of a search, whose probes near the top of the range are not prefetched.
+    template <std::size_t Levels, class RandomIt, class Diff>
+    [[gnu::always_inline]] inline void prefetch_next_midpoints(RandomIt first, Diff count) noexcept
+    {
+        const Diff half = count / 2;
+        const Diff rest = count - half;
+        if constexpr (Levels == 1)
+        {
+            prefetch(first + rest / 2);
+            prefetch(first + half + rest / 2);
+        }
+        else if constexpr (Levels > 1)
+        {
+            prefetch_next_midpoints<Levels - 1>(first, rest);
+            prefetch_next_midpoints<Levels - 1>(first + half, rest);
+        }
+    }
+}
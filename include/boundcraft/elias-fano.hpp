@@ -0,0 +1,319 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include <boundcraft/details/compressed/bit-select.hpp>
+#include <boundcraft/details/isa.hpp>
+
+namespace boundcraft::inline BOUNDCRAFT_ISA
+{
+    // Elias-Fano encoding of a non-decreasing sequence of unsigned integers (posting lists,
+    // offsets, monotone IDs) in about 2 + log2(max / n) bits per element.
+    //
+    // Each value is split into its low `low_bits()` bits, stored packed, and its high part,
+    // stored in unary in a bitvector: element i sets bit high(i) + i, so bucket h (all values
+    // with high part h) is a run of ones ended by the h-th zero. Sampled select indexes over
+    // the ones and zeros jump to any element or bucket in O(1) expected time; lower_bound and
+    // upper_bound select the bucket of the probe and binary-search only its low bits.
+    //
+    // Results are positions in the encoded order.
+    template <std::unsigned_integral T>
+    class elias_fano final
+    {
+    public:
+        // One sample every select_sample ones (and zeros) of the high bitvector.
+        static constexpr std::size_t select_sample = 256;
+
+        class cursor;
+
+        elias_fano() = default;
+
+        explicit elias_fano(std::span<const T> sorted) : size_(sorted.size())
+        {
+            if (size_ == 0)
+            {
+                return;
+            }
+
+            const std::uint64_t last = sorted.back();
+            const std::uint64_t per_element = last / size_;
+            low_bits_ = per_element == 0 ? 0 : static_cast<unsigned>(std::bit_width(per_element)) - 1;
+            low_mask_ = low_bits_ == 0 ? 0 : (std::uint64_t{1} << low_bits_) - 1;
+            max_high_ = static_cast<std::size_t>(last >> low_bits_);
+            high_size_ = size_ + max_high_ + 1;
+
+            high_.assign((high_size_ + 63) / 64 + 1, 0);
+            low_.assign((size_ * low_bits_ + 63) / 64 + 1, 0);
+
+            for (std::size_t i = 0; i < size_; ++i)
+            {
+                const std::uint64_t v = sorted[i];
+                assert(i == 0 || sorted[i - 1] <= sorted[i]);
+
+                const std::size_t pos = static_cast<std::size_t>(v >> low_bits_) + i;
+                high_[pos / 64] |= std::uint64_t{1} << (pos % 64);
+                set_low(i, v & low_mask_);
+            }
+
+            build_select_samples();
+        }
+
+        std::size_t size() const noexcept { return size_; }
+        bool empty() const noexcept { return size_ == 0; }
+        unsigned low_bits() const noexcept { return low_bits_; }
+
+        std::size_t memory_bytes() const noexcept
+        {
+            return (high_.size() + low_.size()) * sizeof(std::uint64_t) +
+                   (one_samples_.size() + zero_samples_.size()) * sizeof(std::size_t);
+        }
+
+        T operator[](std::size_t i) const noexcept
+        {
+            assert(i < size_);
+            return value_at(i, select_one(i));
+        }
+
+        // Position of the first element not less than value (next-GEQ).
+        std::size_t lower_bound(const T &value) const noexcept
+        {
+            return bound<true>(value).first;
+        }
+
+        // Position of the first element greater than value.
+        std::size_t upper_bound(const T &value) const noexcept
+        {
+            return bound<false>(value).first;
+        }
+
+        cursor make_cursor() const noexcept { return cursor(*this); }
+
+    private:
+        struct bucket
+        {
+            std::size_t first_pos; // bit of the bucket's first element
+            std::size_t end_pos;   // the zero that closes the bucket
+            std::size_t first;     // rank of the bucket's first element
+            std::size_t last;      // one past its last element
+        };
+
+        std::uint64_t low(std::size_t i) const noexcept
+        {
+            if (low_bits_ == 0)
+            {
+                return 0;
+            }
+            const std::size_t bit = i * low_bits_;
+            const std::size_t w = bit / 64;
+            const unsigned shift = static_cast<unsigned>(bit % 64);
+
+            std::uint64_t v = low_[w] >> shift;
+            if (shift + low_bits_ > 64)
+            {
+                v |= low_[w + 1] << (64 - shift);
+            }
+            return v & low_mask_;
+        }
+
+        void set_low(std::size_t i, std::uint64_t v) noexcept
+        {
+            if (low_bits_ == 0)
+            {
+                return;
+            }
+            const std::size_t bit = i * low_bits_;
+            const std::size_t w = bit / 64;
+            const unsigned shift = static_cast<unsigned>(bit % 64);
+
+            low_[w] |= v << shift;
+            if (shift + low_bits_ > 64)
+            {
+                low_[w + 1] |= v >> (64 - shift);
+            }
+        }
+
+        // Element i whose set bit sits at high position pos.
+        T value_at(std::size_t i, std::size_t pos) const noexcept
+        {
+            return static_cast<T>((static_cast<std::uint64_t>(pos - i) << low_bits_) | low(i));
+        }
+
+        void build_select_samples()
+        {
+            std::size_t ones = 0;
+            std::size_t zeros = 0;
+            for (std::size_t w = 0; w * 64 < high_size_; ++w)
+            {
+                const std::size_t valid = std::min<std::size_t>(64, high_size_ - w * 64);
+                const std::uint64_t in_range = valid == 64 ? ~std::uint64_t{0} : (std::uint64_t{1} << valid) - 1;
+                const std::uint64_t one_word = high_[w];
+                const std::uint64_t zero_word = ~high_[w] & in_range;
+                const auto c1 = static_cast<std::size_t>(std::popcount(one_word));
+                const auto c0 = static_cast<std::size_t>(std::popcount(zero_word));
+
+                for (std::size_t k = one_samples_.size() * select_sample; k < ones + c1; k += select_sample)
+                {
+                    one_samples_.push_back(w * 64 + boundcraft::detail::bits::select_in_word(one_word, static_cast<unsigned>(k - ones)));
+                }
+                for (std::size_t k = zero_samples_.size() * select_sample; k < zeros + c0; k += select_sample)
+                {
+                    zero_samples_.push_back(w * 64 + boundcraft::detail::bits::select_in_word(zero_word, static_cast<unsigned>(k - zeros)));
+                }
+                ones += c1;
+                zeros += c0;
+            }
+        }
+
+        std::size_t select_one(std::size_t k) const noexcept
+        {
+            return boundcraft::detail::bits::select_one_from(high_.data(), one_samples_[k / select_sample], k % select_sample);
+        }
+
+        std::size_t select_zero(std::size_t k) const noexcept
+        {
+            return boundcraft::detail::bits::select_zero_from(high_.data(), zero_samples_[k / select_sample], k % select_sample);
+        }
+
+        // h <= max_high_.
+        bucket bucket_at(std::size_t h) const noexcept
+        {
+            const std::size_t first_pos = h == 0 ? 0 : select_zero(h - 1) + 1;
+            return bucket_from(first_pos, first_pos - h);
+        }
+
+        // Bucket (or its tail) starting with element `first` at bit first_pos.
+        bucket bucket_from(std::size_t first_pos, std::size_t first) const noexcept
+        {
+            const std::size_t end_pos = boundcraft::detail::bits::select_zero_from(high_.data(), first_pos, 0);
+            return {first_pos, end_pos, first, first + (end_pos - first_pos)};
+        }
+
+        // Binary search of the low bits within one bucket; returns the element rank and its bit.
+        template <bool Lower>
+        std::pair<std::size_t, std::size_t> search_bucket(const bucket &b, std::uint64_t target) const noexcept
+        {
+            std::size_t lo = b.first;
+            std::size_t n = b.last - b.first;
+            while (n > 0)
+            {
+                const std::size_t half = n / 2;
+                const std::uint64_t l = low(lo + half);
+                if (Lower ? (l < target) : !(target < l))
+                {
+                    lo += half + 1;
+                    n -= half + 1;
+                }
+                else
+                {
+                    n = half;
+                }
+            }
+
+            if (lo < b.last)
+            {
+                return {lo, b.first_pos + (lo - b.first)};
+            }
+            // Every element of the bucket is before the answer: it is the first one of a later bucket.
+            return {lo, lo < size_ ? boundcraft::detail::bits::select_one_from(high_.data(), b.end_pos, 0) : high_size_};
+        }
+
+        template <bool Lower>
+        std::pair<std::size_t, std::size_t> bound(const T &value) const noexcept
+        {
+            const auto v = static_cast<std::uint64_t>(value);
+            if (size_ == 0 || (v >> low_bits_) > max_high_)
+            {
+                return {size_, high_size_};
+            }
+            return search_bucket<Lower>(bucket_at(static_cast<std::size_t>(v >> low_bits_)), v & low_mask_);
+        }
+
+        std::size_t size_ = 0;
+        unsigned low_bits_ = 0;
+        std::uint64_t low_mask_ = 0;
+        std::size_t max_high_ = 0;
+        std::size_t high_size_ = 0;
+        std::vector<std::uint64_t> high_;
+        std::vector<std::uint64_t> low_;
+        std::vector<std::size_t> one_samples_;
+        std::vector<std::size_t> zero_samples_;
+    };
+
+    // Forward-only iteration and next-GEQ skipping over an elias_fano sequence, for merge and
+    // intersection loops. Stepping decodes the next set bit directly; a skip that stays in the
+    // current bucket searches only its remaining low bits, and one that leaves it jumps through
+    // the zero select index. Probes passed to lower_bound/upper_bound must not decrease.
+    template <std::unsigned_integral T>
+    class elias_fano<T>::cursor final
+    {
+    public:
+        explicit cursor(const elias_fano &ef) noexcept : ef_(&ef) { reset(); }
+
+        std::size_t position() const noexcept { return i_; }
+        bool at_end() const noexcept { return i_ == ef_->size_; }
+        T value() const noexcept { return ef_->value_at(i_, pos_); }
+
+        void next() noexcept
+        {
+            assert(!at_end());
+            if (++i_ < ef_->size_)
+            {
+                pos_ = boundcraft::detail::bits::select_one_from(ef_->high_.data(), pos_ + 1, 0);
+            }
+            else
+            {
+                pos_ = ef_->high_size_;
+            }
+        }
+
+        // Moves to the first element at or after the cursor that is not less than value.
+        std::size_t lower_bound(const T &key) noexcept { return skip<true>(key); }
+
+        // Moves to the first element at or after the cursor that is greater than value.
+        std::size_t upper_bound(const T &key) noexcept { return skip<false>(key); }
+
+        void reset() noexcept
+        {
+            i_ = 0;
+            pos_ = ef_->size_ == 0 ? ef_->high_size_ : ef_->select_one(0);
+        }
+
+    private:
+        template <bool Lower>
+        std::size_t skip(const T &key) noexcept
+        {
+            if (at_end() || (Lower ? !(value() < key) : key < value()))
+            {
+                return i_;
+            }
+
+            const auto v = static_cast<std::uint64_t>(key);
+            const std::size_t h = static_cast<std::size_t>(v >> ef_->low_bits_);
+            if (h > ef_->max_high_)
+            {
+                i_ = ef_->size_;
+                pos_ = ef_->high_size_;
+                return i_;
+            }
+
+            // The current element is before the answer, so its bucket is at most h.
+            const bucket b = (pos_ - i_ == h) ? ef_->bucket_from(pos_, i_) : ef_->bucket_at(h);
+            const auto [i, pos] = ef_->template search_bucket<Lower>(b, v & ef_->low_mask_);
+            i_ = i;
+            pos_ = pos;
+            return i_;
+        }
+
+        const elias_fano *ef_;
+        std::size_t i_ = 0;
+        std::size_t pos_ = 0;
+    };
+}
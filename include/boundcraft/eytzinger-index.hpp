@@ -0,0 +1,67 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <span>
+#include <vector>
+
+#include <boundcraft/details/aligned-allocator.hpp>
+#include <boundcraft/details/eytzinger/eytzinger-impl.hpp>
+#include <boundcraft/details/isa.hpp>
+
+namespace boundcraft::inline BOUNDCRAFT_ISA
+{
+    // Sorted keys re-laid out in BFS (Eytzinger) order. The top levels of the implicit tree share
+    // a handful of cache lines, and the descent is branchless with the block Prefetch_Levels
+    // levels down requested ahead of time, which pays off once the array no longer fits in cache.
+    //
+    // Results are positions in the original sorted order, so they can index the source array.
+    // They are computed from the final slot number, with no side table to read.
+    // Lookups must use the comparator the source was sorted with.
+    template <class T>
+    class eytzinger_index final
+    {
+    public:
+        static constexpr std::size_t default_prefetch_levels = 4;
+
+        eytzinger_index() = default;
+
+        explicit eytzinger_index(std::span<const T> sorted)
+            : keys_(sorted.size() + 1)
+        {
+            std::size_t next = 0;
+            boundcraft::detail::eytzinger_fill(sorted, keys_.data(), next, 1);
+        }
+
+        std::size_t size() const noexcept { return keys_.empty() ? 0 : keys_.size() - 1; }
+        bool empty() const noexcept { return size() == 0; }
+
+        // The BFS-ordered keys, 1-based (element 0 is padding).
+        std::span<const T> layout() const noexcept { return keys_; }
+
+        template <std::size_t Prefetch_Levels = default_prefetch_levels, class V, class Comp = std::less<>>
+        std::size_t lower_bound(const V &value, Comp comp = {}) const
+        {
+            if (empty())
+            {
+                return 0;
+            }
+            const std::size_t slot = boundcraft::detail::eytzinger_lower_bound_slot<Prefetch_Levels>(keys_.data(), size(), value, comp);
+            return boundcraft::detail::eytzinger_rank(slot, size());
+        }
+
+        template <std::size_t Prefetch_Levels = default_prefetch_levels, class V, class Comp = std::less<>>
+        std::size_t upper_bound(const V &value, Comp comp = {}) const
+        {
+            if (empty())
+            {
+                return 0;
+            }
+            const std::size_t slot = boundcraft::detail::eytzinger_upper_bound_slot<Prefetch_Levels>(keys_.data(), size(), value, comp);
+            return boundcraft::detail::eytzinger_rank(slot, size());
+        }
+
+    private:
+        std::vector<T, boundcraft::detail::aligned_allocator<T>> keys_;
+    };
+}
@@ -0,0 +1,124 @@
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+#include <boundcraft/details/isa.hpp>
+#include <boundcraft/policy.hpp>
+#include <boundcraft/searcher.hpp>
+
+namespace boundcraft::inline BOUNDCRAFT_ISA
+{
+    // Two-level search for sorted arrays that live out of core (mapped_array, a file-backed
+    // mapping, swap). An in-memory array holds the first key of every page of the searched
+    // range (its fence pointers); a lookup searches the fences and then exactly one page, so it
+    // faults in at most one page of the large array instead of one per binary-search step.
+    //
+    // Pages are the blocks of `page_bytes` (a power of two: 4 KiB by default, 2 MiB for huge
+    // pages) starting at addresses that are multiples of page_bytes, whatever the alignment of
+    // the span itself: fences sit on the first record starting in each such block, so page(i)
+    // lies within one OS page. A record straddling a boundary (only possible when sizeof(T) does
+    // not divide page_bytes) belongs to the page it starts in. The index does not own the keys:
+    // the span passed to the constructor must outlive it.
+    template <class T, class Search_Policy = boundcraft::policy::hybrid<16>>
+    class fence_index final
+    {
+    public:
+        static constexpr std::size_t default_page_bytes = 4096;
+
+        fence_index() = default;
+
+        explicit fence_index(std::span<const T> sorted, std::size_t page_bytes = default_page_bytes)
+            : keys_(sorted), page_bytes_(page_bytes)
+        {
+            if (page_bytes_ < sizeof(T))
+            {
+                throw std::invalid_argument("boundcraft::fence_index: page size is smaller than one record");
+            }
+            if (!std::has_single_bit(page_bytes_))
+            {
+                throw std::invalid_argument("boundcraft::fence_index: page size is not a power of two");
+            }
+            if (keys_.empty())
+            {
+                return;
+            }
+
+            const auto base = reinterpret_cast<std::uintptr_t>(keys_.data());
+            const std::uintptr_t end = base + keys_.size() * sizeof(T);
+
+            page_first_.push_back(0);
+            for (std::uintptr_t page = (base & ~(page_bytes_ - 1)) + page_bytes_; page < end; page += page_bytes_)
+            {
+                // First record starting at or after the page boundary.
+                const std::size_t pos = static_cast<std::size_t>((page - base + sizeof(T) - 1) / sizeof(T));
+                if (pos < keys_.size() && pos > page_first_.back())
+                {
+                    page_first_.push_back(pos);
+                }
+            }
+
+            fences_.reserve(page_first_.size());
+            for (std::size_t pos : page_first_)
+            {
+                fences_.push_back(keys_[pos]);
+            }
+            page_first_.push_back(keys_.size());
+        }
+
+        std::size_t size() const noexcept { return keys_.size(); }
+        bool empty() const noexcept { return keys_.empty(); }
+        const T *begin() const noexcept { return keys_.data(); }
+        const T *end() const noexcept { return keys_.data() + keys_.size(); }
+
+        std::size_t page_bytes() const noexcept { return page_bytes_; }
+        std::size_t page_count() const noexcept { return fences_.size(); }
+        // The records of page i, the only ones a lookup landing on fence i reads.
+        std::span<const T> page(std::size_t i) const noexcept
+        {
+            return keys_.subspan(page_first_[i], page_first_[i + 1] - page_first_[i]);
+        }
+        std::size_t memory_bytes() const noexcept
+        {
+            return fences_.size() * sizeof(T) + page_first_.size() * sizeof(std::size_t);
+        }
+
+        const T *lower_bound(const T &value) const
+        {
+            // Pages whose fence is below value end before the answer; the first page whose fence
+            // is not below it starts at or after the answer. So the answer is in the page before.
+            const std::size_t f = fence_rank(searcher<Search_Policy>{}.lower_bound(fences_.data(), fences_.data() + fences_.size(), value, std::less<>{}));
+            if (f == 0)
+            {
+                return begin();
+            }
+            return searcher<Search_Policy>{}.lower_bound(begin() + page_first_[f - 1], begin() + page_first_[f], value, std::less<>{});
+        }
+
+        const T *upper_bound(const T &value) const
+        {
+            const std::size_t f = fence_rank(searcher<Search_Policy>{}.upper_bound(fences_.data(), fences_.data() + fences_.size(), value, std::less<>{}));
+            if (f == 0)
+            {
+                return begin();
+            }
+            return searcher<Search_Policy>{}.upper_bound(begin() + page_first_[f - 1], begin() + page_first_[f], value, std::less<>{});
+        }
+
+    private:
+        std::size_t fence_rank(const T *fence) const noexcept
+        {
+            return static_cast<std::size_t>(fence - fences_.data());
+        }
+
+        std::span<const T> keys_;
+        std::size_t page_bytes_ = default_page_bytes;
+        std::vector<T> fences_;
+        std::vector<std::size_t> page_first_; // first position of each page, then size()
+    };
+}
@@ -0,0 +1,99 @@
+#pragma once
+
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <boundcraft/details/aligned-allocator.hpp>
+#include <boundcraft/details/isa.hpp>
+#include <boundcraft/policy.hpp>
+#include <boundcraft/searcher.hpp>
+
+namespace boundcraft::inline BOUNDCRAFT_ISA
+{
+    // Side index for a sorted array of records searched by one member. The projected keys are
+    // copied into a dense, cache-aligned column, so a probe reads sizeof(key) bytes instead of
+    // pulling in a whole record, and the column gets the policy's SIMD and branchless paths.
+    // Results map straight back to the records by position.
+    //
+    // Proj is anything std::invoke accepts on a record: a pointer to the key member or a lambda.
+    // The index does not own the records: the span passed to the constructor (or to rebind) must
+    // outlive it, and lookups must use the order the records are sorted in.
+    template <class Record, class Proj, class Search_Policy = boundcraft::policy::hybrid<16>>
+        requires std::invocable<const Proj &, const Record &>
+    class key_column_index final
+    {
+    public:
+        using key_type = std::remove_cvref_t<std::invoke_result_t<const Proj &, const Record &>>;
+
+        key_column_index() = default;
+
+        explicit key_column_index(std::span<const Record> sorted, Proj proj = {}) : proj_(std::move(proj))
+        {
+            rebind(sorted);
+        }
+
+        // Points the index at `records` after appends (or a reallocation of the same vector).
+        // Keys already in the column are kept; only records past it are projected, so a batch of
+        // appends costs O(appended). The first size() records must be unchanged; if there are
+        // fewer records than before, the column is cut back to match.
+        void rebind(std::span<const Record> records)
+        {
+            records_ = records;
+            if (keys_.size() > records_.size())
+            {
+                keys_.resize(records_.size());
+            }
+
+            keys_.reserve(records_.size());
+            for (std::size_t i = keys_.size(); i < records_.size(); ++i)
+            {
+                keys_.push_back(std::invoke(proj_, records_[i]));
+            }
+        }
+
+        std::size_t size() const noexcept { return records_.size(); }
+        bool empty() const noexcept { return records_.empty(); }
+        const Record *begin() const noexcept { return records_.data(); }
+        const Record *end() const noexcept { return records_.data() + records_.size(); }
+
+        std::span<const key_type> keys() const noexcept { return {keys_.data(), keys_.size()}; }
+        std::size_t memory_bytes() const noexcept { return keys_.size() * sizeof(key_type); }
+
+        template <class V, class Comp = std::less<>>
+        const Record *lower_bound(const V &value, Comp comp = {}) const
+        {
+            return at(searcher<Search_Policy>{}.lower_bound(key_begin(), key_end(), value, comp));
+        }
+
+        template <class V, class Comp = std::less<>>
+        const Record *upper_bound(const V &value, Comp comp = {}) const
+        {
+            return at(searcher<Search_Policy>{}.upper_bound(key_begin(), key_end(), value, comp));
+        }
+
+    private:
+        const key_type *key_begin() const noexcept { return keys_.data(); }
+        const key_type *key_end() const noexcept { return keys_.data() + keys_.size(); }
+
+        const Record *at(const key_type *key) const noexcept
+        {
+            return begin() + (key - key_begin());
+        }
+
+        std::span<const Record> records_;
+        Proj proj_{};
+        std::vector<key_type, boundcraft::detail::aligned_allocator<key_type>> keys_;
+    };
+
+    // Deduces Proj, e.g. for a lambda projection.
+    template <class Search_Policy = boundcraft::policy::hybrid<16>, class Record, class Proj>
+    key_column_index<Record, Proj, Search_Policy> make_key_column_index(std::span<const Record> sorted, Proj proj)
+    {
+        return key_column_index<Record, Proj, Search_Policy>(sorted, std::move(proj));
+    }
+}
@@ -0,0 +1,184 @@
+#pragma once
+
+#if defined(__unix__) || defined(__APPLE__)
+
+#define BOUNDCRAFT_HAS_MAPPED_ARRAY 1
+
+#include <cerrno>
+#include <cstddef>
+#include <filesystem>
+#include <span>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <boundcraft/details/isa.hpp>
+
+namespace boundcraft::inline BOUNDCRAFT_ISA
+{
+    // Kernel read-ahead hint for a mapped_array (madvise).
+    enum class access_pattern
+    {
+        normal,     // kernel default read-ahead
+        random,     // point lookups: fault in only the touched page
+        sequential, // gallop / merge scans: read ahead aggressively
+        will_need   // start reading the whole file in the background
+    };
+
+    // Read-only memory map of a flat file of fixed-width sorted records, searched in place by
+    // any searcher policy: begin()/end() are plain pointers, so the contiguous fast paths
+    // (SIMD scans, prefetch) apply. Opening costs one mmap call regardless of file size; pages
+    // are faulted in by the searches that touch them.
+    //
+    // Failures to open, stat or map the file, and files whose size is not a whole number of
+    // records, throw std::system_error.
+    template <class T>
+    class mapped_array final
+    {
+        static_assert(std::is_trivially_copyable_v<T>,
+                      "Boundcraft: mapped_array records must be trivially copyable");
+
+    public:
+        mapped_array() = default;
+
+        explicit mapped_array(const std::filesystem::path &path, access_pattern pattern = access_pattern::random)
+        {
+            const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+            if (fd < 0)
+            {
+                throw std::system_error(errno, std::generic_category(), "boundcraft::mapped_array: open " + path.string());
+            }
+
+            struct ::stat st{};
+            if (::fstat(fd, &st) != 0)
+            {
+                const int err = errno;
+                ::close(fd);
+                throw std::system_error(err, std::generic_category(), "boundcraft::mapped_array: fstat " + path.string());
+            }
+
+            const auto bytes = static_cast<std::size_t>(st.st_size);
+            if (bytes % sizeof(T) != 0)
+            {
+                ::close(fd);
+                throw std::system_error(std::make_error_code(std::errc::invalid_argument),
+                                        "boundcraft::mapped_array: size of " + path.string() + " is not a multiple of the record size");
+            }
+
+            if (bytes > 0)
+            {
+                void *p = ::mmap(nullptr, bytes, PROT_READ, MAP_SHARED, fd, 0);
+                if (p == MAP_FAILED)
+                {
+                    const int err = errno;
+                    ::close(fd);
+                    throw std::system_error(err, std::generic_category(), "boundcraft::mapped_array: mmap " + path.string());
+                }
+                data_ = static_cast<const T *>(p);
+                size_ = bytes / sizeof(T);
+            }
+
+            // The mapping keeps the file referenced; the descriptor is no longer needed.
+            ::close(fd);
+            advise(pattern);
+        }
+
+        mapped_array(const mapped_array &) = delete;
+        mapped_array &operator=(const mapped_array &) = delete;
+
+        mapped_array(mapped_array &&other) noexcept
+            : data_(std::exchange(other.data_, nullptr)), size_(std::exchange(other.size_, 0))
+        {
+        }
+
+        mapped_array &operator=(mapped_array &&other) noexcept
+        {
+            if (this != &other)
+            {
+                unmap();
+                data_ = std::exchange(other.data_, nullptr);
+                size_ = std::exchange(other.size_, 0);
+            }
+            return *this;
+        }
+
+        ~mapped_array() { unmap(); }
+
+        std::size_t size() const noexcept { return size_; }
+        bool empty() const noexcept { return size_ == 0; }
+        const T *data() const noexcept { return data_; }
+        const T *begin() const noexcept { return data_; }
+        const T *end() const noexcept { return data_ + size_; }
+        const T &operator[](std::size_t i) const noexcept { return data_[i]; }
+        std::span<const T> span() const noexcept { return {data_, size_}; }
+
+        // Switches the read-ahead hint, e.g. to sequential before a long gallop or merge pass.
+        // Hints are advisory; a kernel that rejects one is not an error.
+        void advise(access_pattern pattern) const noexcept
+        {
+            if (data_ == nullptr)
+            {
+                return;
+            }
+
+            int advice = MADV_NORMAL;
+            switch (pattern)
+            {
+            case access_pattern::normal:
+                advice = MADV_NORMAL;
+                break;
+            case access_pattern::random:
+                advice = MADV_RANDOM;
+                break;
+            case access_pattern::sequential:
+                advice = MADV_SEQUENTIAL;
+                break;
+            case access_pattern::will_need:
+                advice = MADV_WILLNEED;
+                break;
+            }
+            ::madvise(const_cast<T *>(data_), size_ * sizeof(T), advice);
+        }
+
+        // Faults in the pages holding the midpoints of the first `levels` levels of a binary
+        // search (2^levels - 1 records), so the first probes of every later lookup hit memory.
+        void warm_up(std::size_t levels) const noexcept
+        {
+            volatile unsigned char sink = 0;
+            for (std::size_t level = 0; level < levels && level < 31; ++level)
+            {
+                const std::size_t parts = std::size_t{1} << (level + 1);
+                if (parts / 2 > size_)
+                {
+                    break;
+                }
+                for (std::size_t j = 1; j < parts; j += 2)
+                {
+                    const std::size_t i = size_ / parts * j + size_ % parts * j / parts;
+                    sink = sink + *reinterpret_cast<const volatile unsigned char *>(data_ + i);
+                }
+            }
+        }
+
+    private:
+        void unmap() noexcept
+        {
+            if (data_ != nullptr)
+            {
+                ::munmap(const_cast<T *>(data_), size_ * sizeof(T));
+                data_ = nullptr;
+                size_ = 0;
+            }
+        }
+
+        const T *data_ = nullptr;
+        std::size_t size_ = 0;
+    };
+}
+
+#endif
@@ -0,0 +1,132 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <span>
+#include <thread>
+
+#include <boundcraft/details/isa.hpp>
+#include <boundcraft/searcher.hpp>
+#include <boundcraft/thread-pool.hpp>
+
+namespace boundcraft::inline BOUNDCRAFT_ISA
+{
+    // Keys per self-scheduled chunk: large enough to amortise the shared counter, small enough
+    // that a slow chunk (cold region, skewed keys) leaves plenty for the other workers.
+    inline constexpr std::size_t parallel_batch_chunk = 4096;
+
+    namespace detail
+    {
+        template <class Exec>
+        std::size_t executor_concurrency(Exec &exec)
+        {
+            if constexpr (requires { { exec.size() } -> std::convertible_to<std::size_t>; })
+            {
+                return std::max<std::size_t>(exec.size(), 1);
+            }
+            else
+            {
+                return std::max(1u, std::thread::hardware_concurrency());
+            }
+        }
+
+        struct chunk_counters
+        {
+            std::atomic<std::size_t> next{0};
+            std::atomic<std::size_t> done{0};
+        };
+
+        // Workers claim chunks from a shared atomic cursor until none are left, so load balances
+        // itself without locks. The calling thread drains chunks too and then waits only for the
+        // chunks still in flight, never for helper tasks that have not started: a call made from
+        // inside a busy pool therefore still completes. Helpers that start late find no chunk and
+        // touch nothing but the shared counters.
+        template <class Exec, class Search_Chunk>
+        void run_chunked(Exec &exec, std::size_t count, std::size_t chunk, Search_Chunk search_chunk)
+        {
+            if (count == 0)
+            {
+                return;
+            }
+
+            const std::size_t chunks = (count + chunk - 1) / chunk;
+            const std::size_t helpers = std::min(executor_concurrency(exec), chunks) - 1;
+            auto counters = std::make_shared<chunk_counters>();
+
+            auto drain = [counters, chunks, chunk, count, &search_chunk]
+            {
+                for (std::size_t c = counters->next.fetch_add(1, std::memory_order_relaxed); c < chunks;
+                     c = counters->next.fetch_add(1, std::memory_order_relaxed))
+                {
+                    const std::size_t begin = c * chunk;
+                    search_chunk(begin, std::min(chunk, count - begin));
+
+                    if (counters->done.fetch_add(1, std::memory_order_acq_rel) + 1 == chunks)
+                    {
+                        counters->done.notify_all();
+                    }
+                }
+            };
+
+            // Helpers submitted before a failing execute() may already be writing results, so a
+            // submit error is held until the remaining chunks are drained and every one is done.
+            std::exception_ptr submit_error;
+            try
+            {
+                for (std::size_t i = 0; i < helpers; ++i)
+                {
+                    exec.execute(drain);
+                }
+            }
+            catch (...)
+            {
+                submit_error = std::current_exception();
+            }
+            drain();
+
+            for (std::size_t d = counters->done.load(std::memory_order_acquire); d < chunks;
+                 d = counters->done.load(std::memory_order_acquire))
+            {
+                counters->done.wait(d, std::memory_order_acquire);
+            }
+
+            if (submit_error)
+            {
+                std::rethrow_exception(submit_error);
+            }
+        }
+    }
+
+    // Parallel counterparts of searcher<Policy>::lower_bound_batch / upper_bound_batch for large
+    // offline batches against one shared read-only range. Results are written to `out`
+    // (out.size() >= keys.size()); each chunk is resolved with the policy's batch search.
+    // The comparator is called concurrently and must not throw. If exec.execute() throws, the
+    // batch is still completed on the calling thread and the exception is rethrown afterwards.
+    template <class Policy, executor Exec, std::random_access_iterator It, class V, class Comp = std::less<>>
+        requires one_way_lower<Comp, It, V>
+    void parallel_lower_bound_batch(Exec &exec, It first, It last, std::span<const V> keys, std::span<It> out,
+                                    Comp comp = {}, std::size_t chunk = parallel_batch_chunk)
+    {
+        assert(out.size() >= keys.size());
+        detail::run_chunked(exec, keys.size(), std::max<std::size_t>(chunk, 1),
+                            [&](std::size_t begin, std::size_t n)
+                            { searcher<Policy>{}.lower_bound_batch(first, last, keys.subspan(begin, n), out.subspan(begin, n), comp); });
+    }
+
+    template <class Policy, executor Exec, std::random_access_iterator It, class V, class Comp = std::less<>>
+        requires one_way_upper<Comp, It, V>
+    void parallel_upper_bound_batch(Exec &exec, It first, It last, std::span<const V> keys, std::span<It> out,
+                                    Comp comp = {}, std::size_t chunk = parallel_batch_chunk)
+    {
+        assert(out.size() >= keys.size());
+        detail::run_chunked(exec, keys.size(), std::max<std::size_t>(chunk, 1),
+                            [&](std::size_t begin, std::size_t n)
+                            { searcher<Policy>{}.upper_bound_batch(first, last, keys.subspan(begin, n), out.subspan(begin, n), comp); });
+    }
+}
@@ -0,0 +1,201 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <boundcraft/details/isa.hpp>
+#include <boundcraft/details/lower-bound/lower-bound-hybrid-impl.hpp>
+#include <boundcraft/details/upper-bound/upper-bound-hybrid-impl.hpp>
+
+namespace boundcraft::inline BOUNDCRAFT_ISA
+{
+    // Learned index over a read-only sorted array of arithmetic keys (ascending, std::less order),
+    // in the style of the PGM-index.
+    //
+    // The map key -> first position is approximated by piecewise-linear segments, each predicting
+    // the position of every distinct key it covers to within +-Epsilon. A lookup finds its segment
+    // among the (few) segment start keys, evaluates the line, and finishes with the hybrid search
+    // inside the 2 * Epsilon window. The model is a few words per segment, independent of how
+    // many keys each segment covers.
+    //
+    // The index does not own the keys: the span passed to the constructor must outlive it.
+    template <class T, std::size_t Epsilon = 64>
+    class pgm_index final
+    {
+        static_assert(std::is_arithmetic_v<T> && !std::is_same_v<T, bool>,
+                      "Boundcraft: pgm_index requires arithmetic keys");
+        static_assert(Epsilon > 0, "Boundcraft: pgm_index needs a positive error bound");
+
+    public:
+        static constexpr std::size_t epsilon = Epsilon;
+
+        pgm_index() = default;
+
+        explicit pgm_index(std::span<const T> sorted) : keys_(sorted)
+        {
+            build();
+        }
+
+        std::size_t size() const noexcept { return keys_.size(); }
+        bool empty() const noexcept { return keys_.empty(); }
+        const T *begin() const noexcept { return keys_.data(); }
+        const T *end() const noexcept { return keys_.data() + keys_.size(); }
+
+        std::size_t segment_count() const noexcept { return segments_.size(); }
+
+        // Bytes of the model itself; the keys are not owned and not counted.
+        std::size_t memory_bytes() const noexcept
+        {
+            return first_keys_.size() * sizeof(T) + segments_.size() * sizeof(segment);
+        }
+
+        const T *lower_bound(const T &value) const
+        {
+            if (keys_.empty() || !(keys_.front() < value))
+            {
+                return begin();
+            }
+
+            const std::size_t s = segment_for(value);
+            const auto [seg_first, seg_last] = segment_range(s);
+            const auto [lo, hi] = window(s, value, seg_first, seg_last);
+
+            const T *it = boundcraft::detail::lower_bound_hybrid_impl(scan_threshold, begin() + lo, begin() + hi, value, std::less<>{});
+
+            // The fit bounds the error at the segment's distinct keys; a query between two keys
+            // that follow a long run of duplicates can still land outside the window.
+            if (it == begin() + lo && lo > seg_first && !(keys_[lo - 1] < value))
+            {
+                return boundcraft::detail::lower_bound_hybrid_impl(scan_threshold, begin() + seg_first, begin() + lo, value, std::less<>{});
+            }
+            if (it == begin() + hi && hi < seg_last && keys_[hi] < value)
+            {
+                return boundcraft::detail::lower_bound_hybrid_impl(scan_threshold, begin() + hi, begin() + seg_last, value, std::less<>{});
+            }
+            return it;
+        }
+
+        const T *upper_bound(const T &value) const
+        {
+            if (keys_.empty() || value < keys_.front())
+            {
+                return begin();
+            }
+
+            const std::size_t s = segment_for(value);
+            const auto [seg_first, seg_last] = segment_range(s);
+            const auto [lo, hi] = window(s, value, seg_first, seg_last);
+
+            const T *it = boundcraft::detail::upper_bound_hybrid_impl(scan_threshold, begin() + lo, begin() + hi, value, std::less<>{});
+
+            if (it == begin() + lo && lo > seg_first && value < keys_[lo - 1])
+            {
+                return boundcraft::detail::upper_bound_hybrid_impl(scan_threshold, begin() + seg_first, begin() + lo, value, std::less<>{});
+            }
+            if (it == begin() + hi && hi < seg_last && !(value < keys_[hi]))
+            {
+                return boundcraft::detail::upper_bound_hybrid_impl(scan_threshold, begin() + hi, begin() + seg_last, value, std::less<>{});
+            }
+            return it;
+        }
+
+    private:
+        static constexpr std::size_t scan_threshold = 16;
+
+        // position(key) ~= rank + slope * (key - first_keys_[s])
+        struct segment
+        {
+            double slope;
+            std::size_t rank;
+        };
+
+        void build()
+        {
+            const std::size_t n = keys_.size();
+            const double eps = static_cast<double>(Epsilon);
+
+            std::size_t start = 0;
+            double slope_lo = 0.0;
+            double slope_hi = std::numeric_limits<double>::infinity();
+
+            auto close_segment = [&]
+            {
+                const double slope = slope_hi == std::numeric_limits<double>::infinity() ? 0.0 : (slope_lo + slope_hi) / 2;
+                first_keys_.push_back(keys_[start]);
+                segments_.push_back({slope, start});
+            };
+
+            // Shrinking cone: every point (key, first position) seen since `start` narrows the
+            // range of slopes that keeps all of them within +-Epsilon; an empty range starts a
+            // new segment at that point.
+            for (std::size_t i = 1; i < n; ++i)
+            {
+                if (!(keys_[i - 1] < keys_[i]))
+                {
+                    continue;
+                }
+
+                const double dx = static_cast<double>(keys_[i]) - static_cast<double>(keys_[start]);
+                const double dy = static_cast<double>(i - start);
+                const double lo = dx > 0 ? (dy - eps) / dx : std::numeric_limits<double>::infinity();
+                const double hi = dx > 0 ? (dy + eps) / dx : -std::numeric_limits<double>::infinity();
+
+                if (std::max(slope_lo, lo) > std::min(slope_hi, hi))
+                {
+                    close_segment();
+                    start = i;
+                    slope_lo = 0.0;
+                    slope_hi = std::numeric_limits<double>::infinity();
+                    continue;
+                }
+                slope_lo = std::max(slope_lo, lo);
+                slope_hi = std::min(slope_hi, hi);
+            }
+
+            if (n > 0)
+            {
+                close_segment();
+            }
+        }
+
+        // Last segment whose first key is <= value; callers have checked value >= keys_.front().
+        std::size_t segment_for(const T &value) const
+        {
+            const T *it = boundcraft::detail::upper_bound_hybrid_impl(
+                scan_threshold, first_keys_.data(), first_keys_.data() + first_keys_.size(), value, std::less<>{});
+            return static_cast<std::size_t>(it - first_keys_.data()) - 1;
+        }
+
+        // Positions covered by segment s: every answer for a key routed to s lies in this range.
+        std::pair<std::size_t, std::size_t> segment_range(std::size_t s) const
+        {
+            const std::size_t last = s + 1 < segments_.size() ? segments_[s + 1].rank : keys_.size();
+            return {segments_[s].rank, last};
+        }
+
+        std::pair<std::size_t, std::size_t> window(std::size_t s, const T &value, std::size_t seg_first, std::size_t seg_last) const
+        {
+            const segment &seg = segments_[s];
+            const double offset = seg.slope * (static_cast<double>(value) - static_cast<double>(first_keys_[s]));
+            const std::size_t span = seg_last - seg_first;
+            // Written so that NaN (inf * 0 on extreme keys) predicts the segment start.
+            const std::size_t predicted = !(offset > 0)                          ? 0
+                                          : offset >= static_cast<double>(span) ? span
+                                                                                : static_cast<std::size_t>(offset);
+
+            const std::size_t lo = seg_first + (predicted > Epsilon ? predicted - Epsilon : 0);
+            const std::size_t hi = seg_first + std::min(span, predicted + Epsilon + 2);
+            return {lo, hi};
+        }
+
+        std::span<const T> keys_;
+        std::vector<T> first_keys_;
+        std::vector<segment> segments_;
+    };
+}
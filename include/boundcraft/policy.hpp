@@ -2,18 +2,63 @@
 
 #include <cstddef>
 
-namespace boundcraft::policy
+#include <boundcraft/details/isa.hpp>
+
+namespace boundcraft::inline BOUNDCRAFT_ISA::policy
 {
     struct standard_binary final
     {
     };
 
+    struct branchless final
+    {
+    };
+
+    // Binary search for ranges larger than the cache: before each compare it prefetches every
+    // midpoint the probe Levels steps ahead can land on (2 for one level, 4 for two), so memory
+    // latency overlaps the comparisons in between. Probes use the branchless halving step, whose
+    // next addresses do not wait on a predicted branch. On forward iterators it is plain
+    // standard_binary.
+    template <std::size_t Levels = 1>
+    struct prefetch_binary final
+    {
+        static_assert(Levels >= 1 && Levels <= 3,
+                      "Boundcraft: prefetch_binary looks 1 to 3 levels ahead");
+        static constexpr std::size_t levels = Levels;
+    };
+
     template <std::size_t Threshold>
     struct hybrid final
     {
         static constexpr std::size_t threshold = Threshold;
     };
 
+    // hybrid whose threshold is derived from the element type: the linear phase covers one
+    // cache line of elements, or two when the SIMD scan kernel handles the type (see
+    // traits::hybrid_threshold).
+    struct hybrid_auto final
+    {
+    };
+
+    // Estimates each probe from the key values at the ends of the range (numeric keys with
+    // std::less/std::greater). After Max_Probes estimates, or once the range is no larger than
+    // Threshold, the search finishes like hybrid<Threshold>. Other keys use hybrid directly.
+    template <std::size_t Max_Probes = 8, std::size_t Threshold = 16>
+    struct interpolation final
+    {
+        static constexpr std::size_t max_probes = Max_Probes;
+        static constexpr std::size_t threshold = Threshold;
+    };
+
+    // policy::adaptive is declared in <boundcraft/adaptive.hpp>, with the calibration it needs.
+
+    // Searches a prebuilt boundcraft::eytzinger_index; not applicable to plain ranges.
+    template <std::size_t Prefetch_Levels = 4>
+    struct eytzinger final
+    {
+        static constexpr std::size_t prefetch_levels = Prefetch_Levels;
+    };
+
     template <class Search_Policy, class Gallop_Start>
     struct galloping final
     {
@@ -23,7 +68,7 @@ namespace boundcraft::policy
 
 }
 
-namespace boundcraft::policy::gallop
+namespace boundcraft::inline BOUNDCRAFT_ISA::policy::gallop
 {
     struct start_front final
     {
@@ -0,0 +1,116 @@
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <functional>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+#include <boundcraft/details/isa.hpp>
+#include <boundcraft/policy.hpp>
+#include <boundcraft/searcher.hpp>
+
+namespace boundcraft::inline BOUNDCRAFT_ISA
+{
+    // Prefix hint table over a read-only sorted array of integer keys (ascending, std::less order).
+    //
+    // Keys are bucketed by the top Bits bits of (key - min), with the shift chosen from the actual
+    // key range so that the buckets cover [min, max] rather than the whole type. The table stores
+    // the first position of each bucket, so a lookup narrows the range to a single bucket with one
+    // load before running Search_Policy on it.
+    //
+    // The hint does not own the keys: the span passed to the constructor must outlive it.
+    template <class T, std::size_t Bits = 10, class Search_Policy = boundcraft::policy::hybrid<16>>
+    class radix_hint_index final
+    {
+        static_assert(std::is_integral_v<T> && !std::is_same_v<T, bool>,
+                      "Boundcraft: radix_hint_index requires integer keys");
+        static_assert(Bits > 0 && Bits < 32, "Boundcraft: radix_hint_index Bits must be in [1, 31]");
+
+        using key_bits = std::make_unsigned_t<T>;
+
+    public:
+        radix_hint_index() = default;
+
+        explicit radix_hint_index(std::span<const T> sorted) : keys_(sorted)
+        {
+            if (keys_.empty())
+            {
+                return;
+            }
+
+            min_ = keys_.front();
+            max_ = keys_.back();
+
+            const int width = std::bit_width(static_cast<key_bits>(static_cast<key_bits>(max_) - static_cast<key_bits>(min_)));
+            shift_ = width > static_cast<int>(Bits) ? width - static_cast<int>(Bits) : 0;
+
+            const std::size_t buckets = bucket_of(max_) + 1;
+            table_.resize(buckets + 1);
+
+            std::size_t next = 0;
+            for (std::size_t i = 0; i < keys_.size(); ++i)
+            {
+                for (const std::size_t b = bucket_of(keys_[i]); next <= b; ++next)
+                {
+                    table_[next] = i;
+                }
+            }
+            table_[buckets] = keys_.size();
+        }
+
+        std::size_t size() const noexcept { return keys_.size(); }
+        bool empty() const noexcept { return keys_.empty(); }
+        const T *begin() const noexcept { return keys_.data(); }
+        const T *end() const noexcept { return keys_.data() + keys_.size(); }
+
+        std::size_t bucket_count() const noexcept { return table_.empty() ? 0 : table_.size() - 1; }
+        int shift() const noexcept { return shift_; }
+        std::size_t memory_bytes() const noexcept { return table_.size() * sizeof(std::size_t); }
+
+        const T *lower_bound(const T &value) const
+        {
+            if (keys_.empty() || !(min_ < value))
+            {
+                return begin();
+            }
+            if (max_ < value)
+            {
+                return end();
+            }
+
+            // Keys in earlier buckets are below value and keys in later buckets above it.
+            const std::size_t b = bucket_of(value);
+            return boundcraft::searcher<Search_Policy>{}.lower_bound(begin() + table_[b], begin() + table_[b + 1], value, std::less<>{});
+        }
+
+        const T *upper_bound(const T &value) const
+        {
+            if (keys_.empty() || value < min_)
+            {
+                return begin();
+            }
+            if (!(value < max_))
+            {
+                return end();
+            }
+
+            const std::size_t b = bucket_of(value);
+            return boundcraft::searcher<Search_Policy>{}.upper_bound(begin() + table_[b], begin() + table_[b + 1], value, std::less<>{});
+        }
+
+    private:
+        // Callers guarantee min_ <= value; the unsigned difference is then the exact offset.
+        std::size_t bucket_of(const T &value) const noexcept
+        {
+            return static_cast<std::size_t>(static_cast<key_bits>(static_cast<key_bits>(value) - static_cast<key_bits>(min_)) >> shift_);
+        }
+
+        std::span<const T> keys_;
+        std::vector<std::size_t> table_;
+        T min_{};
+        T max_{};
+        int shift_ = 0;
+    };
+}
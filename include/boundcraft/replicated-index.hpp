@@ -0,0 +1,114 @@
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <boundcraft/details/isa.hpp>
+#include <boundcraft/details/numa/node-memory.hpp>
+#include <boundcraft/policy.hpp>
+#include <boundcraft/searcher.hpp>
+
+namespace boundcraft::inline BOUNDCRAFT_ISA
+{
+    struct replica_options
+    {
+        // Ask for transparent huge pages on each replica (Linux MADV_HUGEPAGE), so the top
+        // levels of a large search share a handful of TLB entries.
+        bool huge_pages = false;
+    };
+
+    // One copy of a sorted array (or of any prebuilt flat layout, such as the node array of a
+    // search tree) per NUMA memory node. lower_bound/upper_bound run Search_Policy on the replica
+    // of the node the calling thread is on, so lookups from every socket read local memory.
+    //
+    // Replication needs libnuma (configure with BOUNDCRAFT_WITH_NUMA=ON). Without it, or on a
+    // single-node machine, there is exactly one copy and the index behaves like a plain array.
+    //
+    // Results are positions, identical for every replica.
+    template <class T, class Search_Policy = boundcraft::policy::hybrid<16>>
+    class replicated_index final
+    {
+        static_assert(std::is_trivially_copyable_v<T>,
+                      "Boundcraft: replicated_index elements must be trivially copyable");
+
+    public:
+        replicated_index() = default;
+
+        explicit replicated_index(std::span<const T> sorted, replica_options options = {}) : size_(sorted.size())
+        {
+            const std::vector<int> node_ids = boundcraft::detail::numa::nodes();
+            cpu_slots_ = boundcraft::detail::numa::cpu_slots(node_ids);
+
+            replicas_.reserve(node_ids.size());
+            for (const int node : node_ids)
+            {
+                boundcraft::detail::numa::node_buffer buffer(size_ * sizeof(T), node, options.huge_pages);
+                if (size_ > 0)
+                {
+                    // The first write faults the pages in, on the node the buffer is bound to.
+                    std::memcpy(buffer.data(), sorted.data(), size_ * sizeof(T));
+                }
+                replicas_.push_back(std::move(buffer));
+            }
+        }
+
+        std::size_t size() const noexcept { return size_; }
+        bool empty() const noexcept { return size_ == 0; }
+        std::size_t replica_count() const noexcept { return replicas_.size(); }
+        std::size_t memory_bytes() const noexcept { return replicas_.size() * size_ * sizeof(T); }
+
+        std::span<const T> replica(std::size_t slot) const noexcept
+        {
+            return {static_cast<const T *>(replicas_[slot].data()), size_};
+        }
+
+        // The calling thread's copy. A thread that migrates to another socket keeps working; it
+        // only reads remote memory until its next call.
+        std::span<const T> local() const noexcept
+        {
+            if (replicas_.empty())
+            {
+                return {};
+            }
+            return replica(local_slot());
+        }
+
+        template <class V, class Comp = std::less<>>
+        std::size_t lower_bound(const V &value, Comp comp = {}) const
+        {
+            const std::span<const T> s = local();
+            return static_cast<std::size_t>(searcher<Search_Policy>{}.lower_bound(s.data(), s.data() + s.size(), value, comp) - s.data());
+        }
+
+        template <class V, class Comp = std::less<>>
+        std::size_t upper_bound(const V &value, Comp comp = {}) const
+        {
+            const std::span<const T> s = local();
+            return static_cast<std::size_t>(searcher<Search_Policy>{}.upper_bound(s.data(), s.data() + s.size(), value, comp) - s.data());
+        }
+
+    private:
+        std::size_t local_slot() const noexcept
+        {
+            if (cpu_slots_.empty())
+            {
+                return 0;
+            }
+            const int cpu = boundcraft::detail::numa::current_cpu();
+            if (cpu < 0 || static_cast<std::size_t>(cpu) >= cpu_slots_.size())
+            {
+                return 0;
+            }
+            return cpu_slots_[static_cast<std::size_t>(cpu)];
+        }
+
+        std::size_t size_ = 0;
+        std::vector<boundcraft::detail::numa::node_buffer> replicas_;
+        std::vector<std::size_t> cpu_slots_;
+    };
+}
@@ -0,0 +1,148 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+#include <boundcraft/details/aligned-allocator.hpp>
+#include <boundcraft/details/isa.hpp>
+#include <boundcraft/details/simd/simd-scan.hpp>
+
+namespace boundcraft::inline BOUNDCRAFT_ISA
+{
+    // Static B+-tree over a read-only sorted array of arithmetic keys (ascending, std::less order).
+    //
+    // Every node is one cache line: 16 int32 or 8 int64 keys. A node is resolved by counting the
+    // keys below the search key with one vector compare + movemask per register, and the count is
+    // the child index, so a search visits one node per level (about 6 for 2^26 int32 keys) instead
+    // of making log2(n) dependent probes.
+    //
+    // The leaf level is the sorted keys themselves, padded to whole nodes, so the leaf reached by
+    // the descent directly gives the position in sorted order. Internal nodes hold, for children
+    // 1..B, the smallest key of that child's subtree.
+    //
+    // Only ascending order is supported: the separators, the padding (the largest key) and the
+    // vector compares are all fixed when the tree is built, so the comparator accepted by
+    // lower_bound/upper_bound must be std::less. Build a descending array into an
+    // eytzinger_index or search it with a searcher instead.
+    //
+    // The leaves are a copy of the keys, so results point into the tree, like those of
+    // fence_index and summary_index; subtract begin() for a position.
+    template <class T>
+    class s_tree final
+    {
+        static_assert(std::is_arithmetic_v<T> && !std::is_same_v<T, bool>,
+                      "Boundcraft: s_tree requires arithmetic keys");
+
+    public:
+        static constexpr std::size_t node_keys = boundcraft::detail::cache_line_bytes / sizeof(T);
+        static constexpr std::size_t fanout = node_keys + 1;
+
+        s_tree() = default;
+
+        explicit s_tree(std::span<const T> sorted) : size_(sorted.size())
+        {
+            if (size_ == 0)
+            {
+                return;
+            }
+
+            std::vector<std::size_t> layer_nodes{(size_ + node_keys - 1) / node_keys};
+            while (layer_nodes.back() > 1)
+            {
+                layer_nodes.push_back((layer_nodes.back() + fanout - 1) / fanout);
+            }
+
+            std::size_t total = 0;
+            for (std::size_t nodes : layer_nodes)
+            {
+                layer_offset_.push_back(total);
+                total += nodes * node_keys;
+            }
+
+            keys_.assign(total, pad);
+            std::copy(sorted.begin(), sorted.end(), keys_.begin());
+
+            // Leaves spanned by one subtree rooted at layer h.
+            std::size_t leaves_per_child = 1;
+            for (std::size_t h = 1; h < layer_nodes.size(); ++h)
+            {
+                for (std::size_t j = 0; j < layer_nodes[h]; ++j)
+                {
+                    T *node = keys_.data() + layer_offset_[h] + j * node_keys;
+                    for (std::size_t i = 0; i < node_keys; ++i)
+                    {
+                        const std::size_t child = j * fanout + i + 1;
+                        if (child < layer_nodes[h - 1])
+                        {
+                            node[i] = keys_[child * leaves_per_child * node_keys];
+                        }
+                    }
+                }
+                leaves_per_child *= fanout;
+            }
+        }
+
+        std::size_t size() const noexcept { return size_; }
+        bool empty() const noexcept { return size_ == 0; }
+        const T *begin() const noexcept { return keys_.data(); }
+        const T *end() const noexcept { return keys_.data() + size_; }
+
+        // Bytes of the layout (leaves + internal levels).
+        std::size_t memory_bytes() const noexcept { return keys_.size() * sizeof(T); }
+
+        template <class Comp = std::less<>>
+        const T *lower_bound(const T &value, Comp = {}) const
+        {
+            static_assert(ascending_v<Comp>, "Boundcraft: s_tree is built in std::less order only");
+            return begin() + descend<boundcraft::detail::simd::cmp_op::less>(value);
+        }
+
+        template <class Comp = std::less<>>
+        const T *upper_bound(const T &value, Comp = {}) const
+        {
+            static_assert(ascending_v<Comp>, "Boundcraft: s_tree is built in std::less order only");
+            // Padding compares equal to the largest key, so keep the descent below it.
+            if (!(value < pad))
+            {
+                return end();
+            }
+            return begin() + descend<boundcraft::detail::simd::cmp_op::less_equal>(value);
+        }
+
+    private:
+        template <class Comp>
+        static constexpr bool ascending_v = std::is_same_v<Comp, std::less<>> || std::is_same_v<Comp, std::less<T>>;
+
+        static constexpr T pad = std::numeric_limits<T>::has_infinity ? std::numeric_limits<T>::infinity()
+                                                                       : std::numeric_limits<T>::max();
+
+        template <boundcraft::detail::simd::cmp_op Op>
+        std::size_t descend(const T &value) const
+        {
+            if (size_ == 0)
+            {
+                return 0;
+            }
+
+            std::size_t k = 0;
+            for (std::size_t h = layer_offset_.size() - 1; h > 0; --h)
+            {
+                const T *node = keys_.data() + layer_offset_[h] + k * node_keys;
+                k = k * fanout + boundcraft::detail::simd::count_matching<Op>(node, node_keys, value);
+            }
+
+            const T *leaf = keys_.data() + k * node_keys;
+            const std::size_t pos = k * node_keys + boundcraft::detail::simd::count_matching<Op>(leaf, node_keys, value);
+            return std::min(pos, size_);
+        }
+
+        std::vector<T, boundcraft::detail::aligned_allocator<T>> keys_;
+        std::vector<std::size_t> layer_offset_;
+        std::size_t size_ = 0;
+    };
+}
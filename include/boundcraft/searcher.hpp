@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cassert>
 #include <cstddef>
 #include <span>
 #include <functional>
@@ -7,13 +8,17 @@
 #include <type_traits>
 #include <utility>
 
+#include <boundcraft/details/adaptive/adaptive-fwd.hpp>
+#include <boundcraft/details/equal-range/equal-range.hpp>
+#include <boundcraft/details/isa.hpp>
 #include <boundcraft/details/lower-bound/lower-bound.hpp>
 #include <boundcraft/details/upper-bound/upper-bound.hpp>
 
+#include <boundcraft/eytzinger-index.hpp>
 #include <boundcraft/policy.hpp>
 #include <boundcraft/traits.hpp>
 
-namespace boundcraft
+namespace boundcraft::inline BOUNDCRAFT_ISA
 {
     template <class Comp, class It, class V>
     concept one_way_lower =
@@ -41,6 +46,13 @@ namespace boundcraft
             { std::invoke(comp, v, a) } -> std::convertible_to<bool>; // Key vs Elem
         };
 
+    // Order of the keys handed to the sorted batch searches, relative to the comparator.
+    enum class key_order
+    {
+        ascending,
+        descending
+    };
+
     template <class Policy>
     class searcher final
     {
@@ -192,6 +204,254 @@ namespace boundcraft
             return dispatch_upper(first, last, value, comp);
         }
 
+
+        // Both bounds in one search: probes are shared until one hits an equal key, then each
+        // bound is finished inside its half of the narrowed range.
+        template <class It, class V>
+        std::pair<It, It> equal_range(It first, It last, const V &value)
+        {
+            return equal_range(first, last, value, std::less<>{});
+        }
+
+        template <class It, class V, class Comp>
+            requires one_way_lower<Comp, It, V> && one_way_upper<Comp, It, V>
+        std::pair<It, It> equal_range(It first, It last, const V &value, Comp comp)
+        {
+            return dispatch_equal_range(first, last, value, comp);
+        }
+
+        template <class T, class V>
+        std::pair<T *, T *> equal_range(std::span<T> s, const V &value)
+        {
+            return equal_range(s.data(), s.data() + s.size(), value, std::less<>{});
+        }
+
+        template <class T, class V, class Comp>
+            requires one_way_lower<Comp, T *, V> && one_way_upper<Comp, T *, V>
+        std::pair<T *, T *> equal_range(std::span<T> s, const V &value, Comp comp)
+        {
+            return dispatch_equal_range(s.data(), s.data() + s.size(), value, comp);
+        }
+
+        template <class T, class V>
+        std::pair<const T *, const T *> equal_range(std::span<const T> s, const V &value)
+        {
+            return equal_range(s.data(), s.data() + s.size(), value, std::less<>{});
+        }
+
+        template <class T, class V, class Comp>
+            requires one_way_lower<Comp, const T *, V> && one_way_upper<Comp, const T *, V>
+        std::pair<const T *, const T *> equal_range(std::span<const T> s, const V &value, Comp comp)
+        {
+            return dispatch_equal_range(s.data(), s.data() + s.size(), value, comp);
+        }
+
+        // Layout policies search a prebuilt index and return positions in the original sorted order.
+        template <class T, class V>
+        std::size_t lower_bound(const eytzinger_index<T> &index, const V &value)
+        {
+            return lower_bound(index, value, std::less<>{});
+        }
+
+        template <class T, class V, class Comp>
+        std::size_t lower_bound(const eytzinger_index<T> &index, const V &value, Comp comp)
+        {
+            using traits = boundcraft::policy::traits::policy_traits<Policy>;
+            static_assert(traits::kind == policy_kind::eytzinger,
+                          "Boundcraft: an eytzinger_index is searched with policy::eytzinger");
+            return index.template lower_bound<traits::prefetch_levels>(value, comp);
+        }
+
+        template <class T, class V>
+        std::size_t upper_bound(const eytzinger_index<T> &index, const V &value)
+        {
+            return upper_bound(index, value, std::less<>{});
+        }
+
+        template <class T, class V, class Comp>
+        std::size_t upper_bound(const eytzinger_index<T> &index, const V &value, Comp comp)
+        {
+            using traits = boundcraft::policy::traits::policy_traits<Policy>;
+            static_assert(traits::kind == policy_kind::eytzinger,
+                          "Boundcraft: an eytzinger_index is searched with policy::eytzinger");
+            return index.template upper_bound<traits::prefetch_levels>(value, comp);
+        }
+
+        // Resolves every key in `keys` against [first, last) and writes the results to `out`
+        // (out.size() >= keys.size()). Binary-probing policies advance the searches in lockstep
+        // and prefetch each next midpoint; other policies resolve one key at a time.
+        template <class It, class V>
+        void lower_bound_batch(It first, It last, std::span<const V> keys, std::span<It> out)
+        {
+            lower_bound_batch(first, last, keys, out, std::less<>{});
+        }
+
+        template <class It, class V, class Comp>
+            requires one_way_lower<Comp, It, V>
+        void lower_bound_batch(It first, It last, std::span<const V> keys, std::span<It> out, Comp comp)
+        {
+            dispatch_lower_batch(first, last, keys, out, comp);
+        }
+
+        template <class T, class V>
+        void lower_bound_batch(std::span<T> s, std::span<const V> keys, std::span<T *> out)
+        {
+            lower_bound_batch(s.data(), s.data() + s.size(), keys, out, std::less<>{});
+        }
+
+        template <class T, class V, class Comp>
+            requires one_way_lower<Comp, T *, V>
+        void lower_bound_batch(std::span<T> s, std::span<const V> keys, std::span<T *> out, Comp comp)
+        {
+            dispatch_lower_batch(s.data(), s.data() + s.size(), keys, out, comp);
+        }
+
+        template <class T, class V>
+        void lower_bound_batch(std::span<const T> s, std::span<const V> keys, std::span<const T *> out)
+        {
+            lower_bound_batch(s.data(), s.data() + s.size(), keys, out, std::less<>{});
+        }
+
+        template <class T, class V, class Comp>
+            requires one_way_lower<Comp, const T *, V>
+        void lower_bound_batch(std::span<const T> s, std::span<const V> keys, std::span<const T *> out, Comp comp)
+        {
+            dispatch_lower_batch(s.data(), s.data() + s.size(), keys, out, comp);
+        }
+
+        template <class It, class V>
+        void upper_bound_batch(It first, It last, std::span<const V> keys, std::span<It> out)
+        {
+            upper_bound_batch(first, last, keys, out, std::less<>{});
+        }
+
+        template <class It, class V, class Comp>
+            requires one_way_upper<Comp, It, V>
+        void upper_bound_batch(It first, It last, std::span<const V> keys, std::span<It> out, Comp comp)
+        {
+            dispatch_upper_batch(first, last, keys, out, comp);
+        }
+
+        template <class T, class V>
+        void upper_bound_batch(std::span<T> s, std::span<const V> keys, std::span<T *> out)
+        {
+            upper_bound_batch(s.data(), s.data() + s.size(), keys, out, std::less<>{});
+        }
+
+        template <class T, class V, class Comp>
+            requires one_way_upper<Comp, T *, V>
+        void upper_bound_batch(std::span<T> s, std::span<const V> keys, std::span<T *> out, Comp comp)
+        {
+            dispatch_upper_batch(s.data(), s.data() + s.size(), keys, out, comp);
+        }
+
+        template <class T, class V>
+        void upper_bound_batch(std::span<const T> s, std::span<const V> keys, std::span<const T *> out)
+        {
+            upper_bound_batch(s.data(), s.data() + s.size(), keys, out, std::less<>{});
+        }
+
+        template <class T, class V, class Comp>
+            requires one_way_upper<Comp, const T *, V>
+        void upper_bound_batch(std::span<const T> s, std::span<const V> keys, std::span<const T *> out, Comp comp)
+        {
+            dispatch_upper_batch(s.data(), s.data() + s.size(), keys, out, comp);
+        }
+
+        // Batch search for keys that are already sorted. Each key is searched from the previous
+        // answer by galloping (right for ascending keys, left for descending ones), so m keys cost
+        // O(m log(n/m)) instead of O(m log n). Results are unspecified if the keys are not sorted
+        // in the given order. Forward iterators fall back to one search per key.
+        template <class It, class V>
+        void lower_bound_sorted_batch(It first, It last, std::span<const V> keys, std::span<It> out,
+                                    key_order order = key_order::ascending)
+        {
+            lower_bound_sorted_batch(first, last, keys, out, std::less<>{}, order);
+        }
+
+        template <class It, class V, class Comp>
+            requires one_way_lower<Comp, It, V>
+        void lower_bound_sorted_batch(It first, It last, std::span<const V> keys, std::span<It> out, Comp comp,
+                                    key_order order = key_order::ascending)
+        {
+            dispatch_lower_sorted_batch(first, last, keys, out, comp, order);
+        }
+
+        template <class T, class V>
+        void lower_bound_sorted_batch(std::span<T> s, std::span<const V> keys, std::span<T *> out,
+                                    key_order order = key_order::ascending)
+        {
+            lower_bound_sorted_batch(s.data(), s.data() + s.size(), keys, out, std::less<>{}, order);
+        }
+
+        template <class T, class V, class Comp>
+            requires one_way_lower<Comp, T *, V>
+        void lower_bound_sorted_batch(std::span<T> s, std::span<const V> keys, std::span<T *> out, Comp comp,
+                                    key_order order = key_order::ascending)
+        {
+            dispatch_lower_sorted_batch(s.data(), s.data() + s.size(), keys, out, comp, order);
+        }
+
+        template <class T, class V>
+        void lower_bound_sorted_batch(std::span<const T> s, std::span<const V> keys, std::span<const T *> out,
+                                    key_order order = key_order::ascending)
+        {
+            lower_bound_sorted_batch(s.data(), s.data() + s.size(), keys, out, std::less<>{}, order);
+        }
+
+        template <class T, class V, class Comp>
+            requires one_way_lower<Comp, const T *, V>
+        void lower_bound_sorted_batch(std::span<const T> s, std::span<const V> keys, std::span<const T *> out, Comp comp,
+                                    key_order order = key_order::ascending)
+        {
+            dispatch_lower_sorted_batch(s.data(), s.data() + s.size(), keys, out, comp, order);
+        }
+
+        template <class It, class V>
+        void upper_bound_sorted_batch(It first, It last, std::span<const V> keys, std::span<It> out,
+                                    key_order order = key_order::ascending)
+        {
+            upper_bound_sorted_batch(first, last, keys, out, std::less<>{}, order);
+        }
+
+        template <class It, class V, class Comp>
+            requires one_way_upper<Comp, It, V>
+        void upper_bound_sorted_batch(It first, It last, std::span<const V> keys, std::span<It> out, Comp comp,
+                                    key_order order = key_order::ascending)
+        {
+            dispatch_upper_sorted_batch(first, last, keys, out, comp, order);
+        }
+
+        template <class T, class V>
+        void upper_bound_sorted_batch(std::span<T> s, std::span<const V> keys, std::span<T *> out,
+                                    key_order order = key_order::ascending)
+        {
+            upper_bound_sorted_batch(s.data(), s.data() + s.size(), keys, out, std::less<>{}, order);
+        }
+
+        template <class T, class V, class Comp>
+            requires one_way_upper<Comp, T *, V>
+        void upper_bound_sorted_batch(std::span<T> s, std::span<const V> keys, std::span<T *> out, Comp comp,
+                                    key_order order = key_order::ascending)
+        {
+            dispatch_upper_sorted_batch(s.data(), s.data() + s.size(), keys, out, comp, order);
+        }
+
+        template <class T, class V>
+        void upper_bound_sorted_batch(std::span<const T> s, std::span<const V> keys, std::span<const T *> out,
+                                    key_order order = key_order::ascending)
+        {
+            upper_bound_sorted_batch(s.data(), s.data() + s.size(), keys, out, std::less<>{}, order);
+        }
+
+        template <class T, class V, class Comp>
+            requires one_way_upper<Comp, const T *, V>
+        void upper_bound_sorted_batch(std::span<const T> s, std::span<const V> keys, std::span<const T *> out, Comp comp,
+                                    key_order order = key_order::ascending)
+        {
+            dispatch_upper_sorted_batch(s.data(), s.data() + s.size(), keys, out, comp, order);
+        }
+
     private:
         template <class It, class V, class Comp>
             requires one_way_lower<Comp, It, V>
@@ -200,6 +460,26 @@ namespace boundcraft
         template <class It, class V, class Comp>
             requires one_way_upper<Comp, It, V>
         static It dispatch_upper(It first, It last, const V &value, Comp comp);
+
+        template <class It, class V, class Comp>
+            requires one_way_lower<Comp, It, V> && one_way_upper<Comp, It, V>
+        static std::pair<It, It> dispatch_equal_range(It first, It last, const V &value, Comp comp);
+
+        template <class It, class V, class Comp>
+            requires one_way_lower<Comp, It, V>
+        static void dispatch_lower_batch(It first, It last, std::span<const V> keys, std::span<It> out, Comp comp);
+
+        template <class It, class V, class Comp>
+            requires one_way_upper<Comp, It, V>
+        static void dispatch_upper_batch(It first, It last, std::span<const V> keys, std::span<It> out, Comp comp);
+
+        template <class It, class V, class Comp>
+            requires one_way_lower<Comp, It, V>
+        static void dispatch_lower_sorted_batch(It first, It last, std::span<const V> keys, std::span<It> out, Comp comp, key_order order);
+
+        template <class It, class V, class Comp>
+            requires one_way_upper<Comp, It, V>
+        static void dispatch_upper_sorted_batch(It first, It last, std::span<const V> keys, std::span<It> out, Comp comp, key_order order);
     };
 
     template <class Policy>
@@ -214,11 +494,28 @@ namespace boundcraft
         {
             return boundcraft::detail::lower_bound_standard_binary_impl(first, last, value, comp);
         }
+        else if constexpr (k == policy_kind::branchless)
+        {
+            return boundcraft::detail::lower_bound_branchless_impl(first, last, value, comp);
+        }
+        else if constexpr (k == policy_kind::prefetch_binary)
+        {
+            return boundcraft::detail::lower_bound_prefetch_binary_impl<traits::levels>(first, last, value, comp);
+        }
         else if constexpr (k == policy_kind::hybrid)
         {
-            constexpr std::size_t threshold = traits::threshold;
+            constexpr std::size_t threshold = boundcraft::policy::traits::hybrid_threshold_v<Policy, std::iter_value_t<It>>;
             return boundcraft::detail::lower_bound_hybrid_impl(threshold, first, last, value, comp);
         }
+        else if constexpr (k == policy_kind::interpolation)
+        {
+            return boundcraft::detail::lower_bound_interpolation_impl<traits::max_probes, traits::threshold>(
+                first, last, value, comp);
+        }
+        else if constexpr (k == policy_kind::adaptive)
+        {
+            return boundcraft::detail::lower_bound_adaptive_impl(first, last, value, comp);
+        }
         else if constexpr (k == policy_kind::galloping)
         {
             using search_policy_t = typename traits::search_policy;
@@ -227,6 +524,13 @@ namespace boundcraft
             return boundcraft::detail::lower_bound_gallop_impl<search_policy_t, gallop_start_t>(
                 first, last, value, comp);
         }
+        else if constexpr (k == policy_kind::eytzinger)
+        {
+            static_assert(boundcraft::detail::always_false_v<It>,
+                          "Boundcraft: policy::eytzinger searches an eytzinger_index, not a plain range. "
+                          "Build one with boundcraft::eytzinger_index<T>(sorted_span).");
+            return first;
+        }
         else
         {
             static_assert([]{ return false; }(), "Unknown policy");
@@ -245,11 +549,28 @@ namespace boundcraft
         {
             return boundcraft::detail::upper_bound_standard_binary_impl(first, last, value, comp);
         }
+        else if constexpr (k == policy_kind::branchless)
+        {
+            return boundcraft::detail::upper_bound_branchless_impl(first, last, value, comp);
+        }
+        else if constexpr (k == policy_kind::prefetch_binary)
+        {
+            return boundcraft::detail::upper_bound_prefetch_binary_impl<traits::levels>(first, last, value, comp);
+        }
         else if constexpr (k == policy_kind::hybrid)
         {
-            constexpr std::size_t threshold = traits::threshold;
+            constexpr std::size_t threshold = boundcraft::policy::traits::hybrid_threshold_v<Policy, std::iter_value_t<It>>;
             return boundcraft::detail::upper_bound_hybrid_impl(threshold, first, last, value, comp);
         }
+        else if constexpr (k == policy_kind::interpolation)
+        {
+            return boundcraft::detail::upper_bound_interpolation_impl<traits::max_probes, traits::threshold>(
+                first, last, value, comp);
+        }
+        else if constexpr (k == policy_kind::adaptive)
+        {
+            return boundcraft::detail::upper_bound_adaptive_impl(first, last, value, comp);
+        }
         else if constexpr (k == policy_kind::galloping)
         {
             using search_policy_t = typename traits::search_policy;
@@ -258,6 +579,13 @@ namespace boundcraft
             return boundcraft::detail::upper_bound_gallop_impl<search_policy_t, gallop_start_t>(
                 first, last, value, comp);
         }
+        else if constexpr (k == policy_kind::eytzinger)
+        {
+            static_assert(boundcraft::detail::always_false_v<It>,
+                          "Boundcraft: policy::eytzinger searches an eytzinger_index, not a plain range. "
+                          "Build one with boundcraft::eytzinger_index<T>(sorted_span).");
+            return first;
+        }
         else
         {
             static_assert([]
@@ -265,4 +593,172 @@ namespace boundcraft
         }
     }
 
+    template <class Policy>
+    template <class It, class V, class Comp>
+        requires one_way_lower<Comp, It, V> && one_way_upper<Comp, It, V>
+    std::pair<It, It> searcher<Policy>::dispatch_equal_range(It first, It last, const V &value, Comp comp)
+    {
+        using traits = boundcraft::policy::traits::policy_traits<Policy>;
+        constexpr auto k = traits::kind;
+
+        if constexpr (k == policy_kind::standard_binary || k == policy_kind::branchless || k == policy_kind::hybrid)
+        {
+            return boundcraft::detail::equal_range_split_impl<Policy>(first, last, value, comp);
+        }
+        else if constexpr (k == policy_kind::prefetch_binary)
+        {
+            // The three-way bisection would probe without prefetching; find the lower bound with
+            // the policy and gallop over the run of equal keys from there.
+            if constexpr (std::random_access_iterator<It>)
+            {
+                return boundcraft::detail::equal_range_from_lower<Policy>(dispatch_lower(first, last, value, comp), last, value, comp);
+            }
+            else
+            {
+                return boundcraft::detail::equal_range_split_impl<boundcraft::policy::standard_binary>(first, last, value, comp);
+            }
+        }
+        else if constexpr (k == policy_kind::interpolation)
+        {
+            if constexpr (std::random_access_iterator<It>)
+            {
+                return boundcraft::detail::equal_range_from_lower<Policy>(dispatch_lower(first, last, value, comp), last, value, comp);
+            }
+            else
+            {
+                using fallback_t = boundcraft::policy::hybrid<traits::threshold>;
+                return boundcraft::detail::equal_range_split_impl<fallback_t>(first, last, value, comp);
+            }
+        }
+        else if constexpr (k == policy_kind::adaptive)
+        {
+            if constexpr (std::random_access_iterator<It>)
+            {
+                // The galloped bracket past the lower bound is searched with the calibrated kernel
+                // for its length, like every other adaptive search.
+                return boundcraft::detail::equal_range_from_lower<Policy>(dispatch_lower(first, last, value, comp), last, value, comp);
+            }
+            else
+            {
+                return boundcraft::detail::equal_range_split_impl<boundcraft::policy::hybrid<16>>(first, last, value, comp);
+            }
+        }
+        else if constexpr (k == policy_kind::galloping)
+        {
+            // The start policy locates the lower bound; the run of equal keys is then galloped
+            // from there rather than searched for again.
+            using search_policy_t = typename traits::search_policy;
+            return boundcraft::detail::equal_range_from_lower<search_policy_t>(dispatch_lower(first, last, value, comp), last, value, comp);
+        }
+        else if constexpr (k == policy_kind::eytzinger)
+        {
+            static_assert(boundcraft::detail::always_false_v<It>,
+                          "Boundcraft: policy::eytzinger searches an eytzinger_index, not a plain range. "
+                          "Build one with boundcraft::eytzinger_index<T>(sorted_span).");
+            return {first, first};
+        }
+        else
+        {
+            static_assert([]{ return false; }(), "Unknown policy");
+        }
+    }
+
+    template <class Policy>
+    template <class It, class V, class Comp>
+        requires one_way_lower<Comp, It, V>
+    void searcher<Policy>::dispatch_lower_batch(It first, It last, std::span<const V> keys, std::span<It> out, Comp comp)
+    {
+        assert(out.size() >= keys.size());
+
+        if constexpr (boundcraft::detail::batch_lockstep_v<Policy, It>)
+        {
+            boundcraft::detail::lower_bound_batch_impl<Policy>(first, last, keys, out, comp);
+        }
+        else
+        {
+            for (std::size_t i = 0; i < keys.size(); ++i)
+            {
+                out[i] = dispatch_lower(first, last, keys[i], comp);
+            }
+        }
+    }
+
+    template <class Policy>
+    template <class It, class V, class Comp>
+        requires one_way_upper<Comp, It, V>
+    void searcher<Policy>::dispatch_upper_batch(It first, It last, std::span<const V> keys, std::span<It> out, Comp comp)
+    {
+        assert(out.size() >= keys.size());
+
+        if constexpr (boundcraft::detail::batch_lockstep_v<Policy, It>)
+        {
+            boundcraft::detail::upper_bound_batch_impl<Policy>(first, last, keys, out, comp);
+        }
+        else
+        {
+            for (std::size_t i = 0; i < keys.size(); ++i)
+            {
+                out[i] = dispatch_upper(first, last, keys[i], comp);
+            }
+        }
+    }
+
+    template <class Policy>
+    template <class It, class V, class Comp>
+        requires one_way_lower<Comp, It, V>
+    void searcher<Policy>::dispatch_lower_sorted_batch(It first, It last, std::span<const V> keys, std::span<It> out, Comp comp, key_order order)
+    {
+        assert(out.size() >= keys.size());
+
+        if constexpr (std::random_access_iterator<It>)
+        {
+            using search_policy_t = boundcraft::policy::traits::inner_search_policy_t<Policy>;
+
+            if (order == key_order::ascending)
+            {
+                boundcraft::detail::lower_bound_ascending_batch_impl<search_policy_t>(first, last, keys, out, comp);
+            }
+            else
+            {
+                boundcraft::detail::lower_bound_descending_batch_impl<search_policy_t>(first, last, keys, out, comp);
+            }
+        }
+        else
+        {
+            for (std::size_t i = 0; i < keys.size(); ++i)
+            {
+                out[i] = dispatch_lower(first, last, keys[i], comp);
+            }
+        }
+    }
+
+    template <class Policy>
+    template <class It, class V, class Comp>
+        requires one_way_upper<Comp, It, V>
+    void searcher<Policy>::dispatch_upper_sorted_batch(It first, It last, std::span<const V> keys, std::span<It> out, Comp comp, key_order order)
+    {
+        assert(out.size() >= keys.size());
+
+        if constexpr (std::random_access_iterator<It>)
+        {
+            using search_policy_t = boundcraft::policy::traits::inner_search_policy_t<Policy>;
+
+            if (order == key_order::ascending)
+            {
+                boundcraft::detail::upper_bound_ascending_batch_impl<search_policy_t>(first, last, keys, out, comp);
+            }
+            else
+            {
+                boundcraft::detail::upper_bound_descending_batch_impl<search_policy_t>(first, last, keys, out, comp);
+            }
+        }
+        else
+        {
+            for (std::size_t i = 0; i < keys.size(); ++i)
+            {
+                out[i] = dispatch_upper(first, last, keys[i], comp);
+            }
+        }
+    }
+
 }
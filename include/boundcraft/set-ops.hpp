@@ -0,0 +1,107 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <span>
+#include <utility>
+
+#include <boundcraft/details/isa.hpp>
+#include <boundcraft/details/set-ops/intersect-impl.hpp>
+#include <boundcraft/details/set-ops/intersect-k-impl.hpp>
+#include <boundcraft/details/set-ops/merge-k-impl.hpp>
+#include <boundcraft/policy.hpp>
+#include <boundcraft/traits.hpp>
+
+namespace boundcraft::inline BOUNDCRAFT_ISA
+{
+    // Above this size ratio the larger list is galloped through; below it a merge touches fewer
+    // cache lines than the probes would.
+    inline constexpr std::size_t intersect_merge_ratio = 16;
+
+    namespace detail
+    {
+        template <class Policy, class T, class Comp, class Emit>
+        void intersect_dispatch(std::span<const T> a, std::span<const T> b, Comp comp, Emit emit)
+        {
+            using search_policy_t = boundcraft::policy::traits::inner_search_policy_t<Policy>;
+
+            if (a.size() > b.size())
+            {
+                std::swap(a, b);
+            }
+
+            if (b.size() / intersect_merge_ratio < a.size())
+            {
+                intersect_merge_impl(a.data(), a.data() + a.size(), b.data(), b.data() + b.size(), comp, emit);
+            }
+            else
+            {
+                intersect_gallop_impl<search_policy_t>(a.data(), a.data() + a.size(), b.data(), b.data() + b.size(), comp, emit);
+            }
+        }
+    }
+
+    // Intersection of two sorted lists (either order of sizes) written to `out`, which must hold
+    // at least min(a.size(), b.size()) elements. Returns the number of elements written.
+    // Duplicates follow std::set_intersection: each value appears min(count in a, count in b)
+    // times. Policy is the search used inside each gallop bracket (a galloping<...> policy
+    // contributes its inner search).
+    template <class Policy = boundcraft::policy::hybrid<16>, class T, class Comp = std::less<>>
+    std::size_t intersect(std::span<const T> a, std::span<const T> b, std::span<T> out, Comp comp = {})
+    {
+        assert(out.size() >= std::min(a.size(), b.size()));
+
+        std::size_t n = 0;
+        detail::intersect_dispatch<Policy>(a, b, comp, [&](const T &x) { out[n++] = x; });
+        return n;
+    }
+
+    template <class Policy = boundcraft::policy::hybrid<16>, class T, class Comp = std::less<>>
+    std::size_t count_intersection(std::span<const T> a, std::span<const T> b, Comp comp = {})
+    {
+        std::size_t n = 0;
+        detail::intersect_dispatch<Policy>(a, b, comp, [&](const T &) { ++n; });
+        return n;
+    }
+
+    // Intersection of any number of sorted lists, adaptive to how they interleave rather than
+    // chained pairwise. `out` must hold at least as many elements as the shortest list. Returns
+    // the number written; duplicates appear as often as in the list with the fewest copies.
+    template <class Policy = boundcraft::policy::hybrid<16>, class T, class Comp = std::less<>>
+    std::size_t intersect_k(std::span<const std::span<const T>> lists, std::span<T> out, Comp comp = {})
+    {
+        using search_policy_t = boundcraft::policy::traits::inner_search_policy_t<Policy>;
+
+        std::size_t n = 0;
+        detail::intersect_k_impl<search_policy_t>(lists, comp, [&](const T &x)
+                                                  { assert(n < out.size()); out[n++] = x; });
+        return n;
+    }
+
+    // Union of sorted lists into `out`, each value as often as the list holding the most copies
+    // of it (std::set_union semantics). `out` must hold the sum of the list sizes in the worst
+    // case. Returns the number of elements written.
+    template <class Policy = boundcraft::policy::hybrid<16>, class T, class Comp = std::less<>>
+    std::size_t union_k(std::span<const std::span<const T>> lists, std::span<T> out, Comp comp = {})
+    {
+        using search_policy_t = boundcraft::policy::traits::inner_search_policy_t<Policy>;
+
+        std::size_t n = 0;
+        detail::union_k_impl<search_policy_t>(lists, comp, [&](const T &x)
+                                              { assert(n < out.size()); out[n++] = x; });
+        return n;
+    }
+
+    // All elements of all lists in sorted order (std::merge generalised to k lists). `out` must
+    // hold the sum of the list sizes. Returns the number of elements written.
+    template <class T, class Comp = std::less<>>
+    std::size_t merge_k(std::span<const std::span<const T>> lists, std::span<T> out, Comp comp = {})
+    {
+        std::size_t n = 0;
+        detail::merge_k_impl(lists, comp, [&](const T &x)
+                             { assert(n < out.size()); out[n++] = x; });
+        return n;
+    }
+}
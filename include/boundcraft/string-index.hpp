@@ -0,0 +1,174 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <boundcraft/details/aligned-allocator.hpp>
+#include <boundcraft/details/isa.hpp>
+#include <boundcraft/details/upper-bound/upper-bound-gallop-impl.hpp>
+#include <boundcraft/policy.hpp>
+#include <boundcraft/searcher.hpp>
+
+namespace boundcraft::inline BOUNDCRAFT_ISA
+{
+    namespace detail
+    {
+        // First 8 bytes of s as a big-endian integer, zero padded. Integer order of the prefixes
+        // agrees with the byte-wise (unsigned char) order of the strings: a smaller prefix means a
+        // smaller string, and only equal prefixes need the full compare.
+        inline std::uint64_t normalized_prefix(std::string_view s) noexcept
+        {
+            unsigned char bytes[8] = {};
+            std::memcpy(bytes, s.data(), std::min<std::size_t>(s.size(), 8));
+
+            std::uint64_t p;
+            std::memcpy(&p, bytes, 8);
+            if constexpr (std::endian::native == std::endian::little)
+            {
+                p = std::byteswap(p);
+            }
+            return p;
+        }
+
+        // Orders strings by their bytes after `skip`, which all operands share.
+        struct string_suffix_less
+        {
+            std::size_t skip = 0;
+
+            template <class A, class B>
+            bool operator()(const A &a, const B &b) const noexcept
+            {
+                return std::string_view(a).substr(skip) < std::string_view(b).substr(skip);
+            }
+        };
+    }
+
+    // Search over sorted strings (URLs, paths, names) that keeps an 8-byte normalized prefix of
+    // every key in a dense, cache-aligned integer array. A lookup searches the prefixes with
+    // Search_Policy, which gets the SIMD and branchless integer paths, and dereferences the
+    // strings only inside the run of keys sharing the probe's prefix. Keys that differ within
+    // those 8 bytes are therefore ordered without a single string compare.
+    //
+    // The prefixes start after the bytes every key has in common (the first and last key's
+    // common prefix, e.g. "https://" or a shared root directory), so a constant scheme or path
+    // head does not use up the 8 bytes.
+    //
+    // Keys must be sorted in std::string_view order (byte-wise, as std::string sorts). The index
+    // does not own the keys: the span passed to the constructor must outlive it.
+    template <class String = std::string, class Search_Policy = boundcraft::policy::hybrid<16>>
+        requires std::convertible_to<const String &, std::string_view>
+    class string_index final
+    {
+    public:
+        string_index() = default;
+
+        explicit string_index(std::span<const String> sorted) : keys_(sorted)
+        {
+            if (keys_.empty())
+            {
+                return;
+            }
+
+            const std::string_view first = keys_.front();
+            const std::string_view last = keys_.back();
+            const auto diff = std::mismatch(first.begin(), first.end(), last.begin(), last.end());
+            common_.assign(first.begin(), diff.first);
+
+            prefixes_.reserve(keys_.size());
+            for (const String &s : keys_)
+            {
+                prefixes_.push_back(boundcraft::detail::normalized_prefix(std::string_view(s).substr(common_.size())));
+            }
+        }
+
+        std::size_t size() const noexcept { return keys_.size(); }
+        bool empty() const noexcept { return keys_.empty(); }
+        const String *begin() const noexcept { return keys_.data(); }
+        const String *end() const noexcept { return keys_.data() + keys_.size(); }
+
+        // Bytes shared by every key; the prefixes cover the 8 bytes after it.
+        std::string_view common_prefix() const noexcept { return common_; }
+        std::span<const std::uint64_t> prefixes() const noexcept { return {prefixes_.data(), prefixes_.size()}; }
+        std::size_t memory_bytes() const noexcept { return prefixes_.size() * sizeof(std::uint64_t) + common_.size(); }
+
+        const String *lower_bound(std::string_view value) const
+        {
+            return bound<true>(value);
+        }
+
+        const String *upper_bound(std::string_view value) const
+        {
+            return bound<false>(value);
+        }
+
+    private:
+        template <bool Lower>
+        const String *bound(std::string_view value) const
+        {
+            if (keys_.empty())
+            {
+                return begin();
+            }
+
+            // Outside the shared head the probe orders before or after every key at once.
+            const int head = value.substr(0, common_.size()).compare(common_);
+            if (head != 0)
+            {
+                return head < 0 ? begin() : end();
+            }
+
+            const std::string_view rest = value.substr(common_.size());
+            const std::uint64_t p = boundcraft::detail::normalized_prefix(rest);
+            const std::uint64_t *lo = searcher<Search_Policy>{}.lower_bound(prefix_begin(), prefix_end(), p, std::less<>{});
+            const std::uint64_t *hi = tie_end(lo, p);
+            if (lo == hi)
+            {
+                return at(lo);
+            }
+
+            const boundcraft::detail::string_suffix_less comp{common_.size()};
+            if constexpr (Lower)
+            {
+                return searcher<Search_Policy>{}.lower_bound(at(lo), at(hi), value, comp);
+            }
+            else
+            {
+                return searcher<Search_Policy>{}.upper_bound(at(lo), at(hi), value, comp);
+            }
+        }
+
+        using search_policy = boundcraft::policy::traits::inner_search_policy_t<Search_Policy>;
+
+        const std::uint64_t *prefix_begin() const noexcept { return prefixes_.data(); }
+        const std::uint64_t *prefix_end() const noexcept { return prefixes_.data() + prefixes_.size(); }
+
+        const String *at(const std::uint64_t *prefix) const noexcept
+        {
+            return begin() + (prefix - prefix_begin());
+        }
+
+        // End of the run of keys whose prefix equals p, galloping from its start: runs are short
+        // for most key sets, and a long shared prefix still costs only O(log run).
+        const std::uint64_t *tie_end(const std::uint64_t *lo, std::uint64_t p) const
+        {
+            if (lo == prefix_end() || *lo != p)
+            {
+                return lo;
+            }
+            return boundcraft::detail::upper_bound_gallop_from<search_policy>(lo, prefix_end(), lo, p, std::less<>{});
+        }
+
+        std::span<const String> keys_;
+        std::string common_;
+        std::vector<std::uint64_t, boundcraft::detail::aligned_allocator<std::uint64_t>> prefixes_;
+    };
+}
@@ -0,0 +1,107 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+#include <boundcraft/details/aligned-allocator.hpp>
+#include <boundcraft/details/isa.hpp>
+#include <boundcraft/policy.hpp>
+#include <boundcraft/searcher.hpp>
+
+namespace boundcraft::inline BOUNDCRAFT_ISA
+{
+    // Two-tier search over a sorted array in its original layout. A cache-aligned summary holds
+    // every stride()-th key and is small enough (summary_bytes) to stay in L1/L2 between lookups.
+    // A lookup searches the summary with policy::hybrid_auto (SIMD-scanned where the key type
+    // allows) and then only the stride-wide slice of the array between two samples with
+    // Search_Policy. The first ~log2(size / stride) probes of a plain binary search, each a
+    // likely cache miss on a large array, become hits on the summary.
+    //
+    // Unlike eytzinger_index or s_tree the keys are not copied or reordered, so any span works,
+    // including a mapped_array. The index does not own the keys: the span passed to the
+    // constructor must outlive it.
+    template <class T, class Search_Policy = boundcraft::policy::hybrid<16>>
+    class summary_index final
+    {
+    public:
+        static constexpr std::size_t default_summary_bytes = 32 * 1024;
+
+        summary_index() = default;
+
+        explicit summary_index(std::span<const T> sorted, std::size_t summary_bytes = default_summary_bytes)
+            : keys_(sorted)
+        {
+            if (summary_bytes < sizeof(T))
+            {
+                throw std::invalid_argument("boundcraft::summary_index: summary is smaller than one key");
+            }
+            if (keys_.empty())
+            {
+                return;
+            }
+
+            const std::size_t capacity = summary_bytes / sizeof(T);
+            stride_ = std::max<std::size_t>((keys_.size() + capacity - 1) / capacity, 1);
+
+            samples_.reserve((keys_.size() + stride_ - 1) / stride_);
+            for (std::size_t pos = 0; pos < keys_.size(); pos += stride_)
+            {
+                samples_.push_back(keys_[pos]);
+            }
+        }
+
+        std::size_t size() const noexcept { return keys_.size(); }
+        bool empty() const noexcept { return keys_.empty(); }
+        const T *begin() const noexcept { return keys_.data(); }
+        const T *end() const noexcept { return keys_.data() + keys_.size(); }
+
+        std::size_t stride() const noexcept { return stride_; }
+        std::span<const T> samples() const noexcept { return {samples_.data(), samples_.size()}; }
+        std::size_t memory_bytes() const noexcept { return samples_.size() * sizeof(T); }
+
+        const T *lower_bound(const T &value) const
+        {
+            // Samples below value sit before the answer and the first sample not below it sits at
+            // or after it, so the answer is in the slice after the last sample below value.
+            const std::size_t j = sample_rank(searcher<summary_policy>{}.lower_bound(sample_begin(), sample_end(), value, std::less<>{}));
+            if (j == 0)
+            {
+                return begin();
+            }
+            return searcher<Search_Policy>{}.lower_bound(slice_first(j), slice_last(j), value, std::less<>{});
+        }
+
+        const T *upper_bound(const T &value) const
+        {
+            const std::size_t j = sample_rank(searcher<summary_policy>{}.upper_bound(sample_begin(), sample_end(), value, std::less<>{}));
+            if (j == 0)
+            {
+                return begin();
+            }
+            return searcher<Search_Policy>{}.upper_bound(slice_first(j), slice_last(j), value, std::less<>{});
+        }
+
+    private:
+        using summary_policy = boundcraft::policy::hybrid_auto;
+
+        const T *sample_begin() const noexcept { return samples_.data(); }
+        const T *sample_end() const noexcept { return samples_.data() + samples_.size(); }
+
+        std::size_t sample_rank(const T *sample) const noexcept
+        {
+            return static_cast<std::size_t>(sample - sample_begin());
+        }
+
+        // Keys strictly between sample j - 1 (already known to be before the answer) and sample j.
+        const T *slice_first(std::size_t j) const noexcept { return begin() + (j - 1) * stride_ + 1; }
+        const T *slice_last(std::size_t j) const noexcept { return begin() + std::min(j * stride_, keys_.size()); }
+
+        std::span<const T> keys_;
+        std::size_t stride_ = 1;
+        std::vector<T, boundcraft::detail::aligned_allocator<T>> samples_;
+    };
+}
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <algorithm>
+#include <concepts>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <boundcraft/details/isa.hpp>
+
+namespace boundcraft::inline BOUNDCRAFT_ISA
+{
+    // Anything that can run a task, now or later, on some thread. The parallel batch searches
+    // only hand it self-contained tasks and wait for them on their own, so a plain
+    // "run it inline" executor is valid too.
+    template <class Exec>
+    concept executor = requires(Exec &exec, std::function<void()> task) {
+        exec.execute(std::move(task));
+    };
+
+    // Fixed-size pool of worker threads fed from one FIFO. The lock only guards the task queue;
+    // the tasks themselves share nothing through the pool.
+    class thread_pool final
+    {
+    public:
+        explicit thread_pool(std::size_t threads = std::max(1u, std::thread::hardware_concurrency()))
+        {
+            threads = std::max<std::size_t>(threads, 1);
+            workers_.reserve(threads);
+            for (std::size_t i = 0; i < threads; ++i)
+            {
+                workers_.emplace_back([this] { run(); });
+            }
+        }
+
+        thread_pool(const thread_pool &) = delete;
+        thread_pool &operator=(const thread_pool &) = delete;
+
+        ~thread_pool()
+        {
+            {
+                std::lock_guard lock(mutex_);
+                stopping_ = true;
+            }
+            ready_.notify_all();
+            for (auto &w : workers_)
+            {
+                w.join();
+            }
+        }
+
+        std::size_t size() const noexcept { return workers_.size(); }
+
+        void execute(std::function<void()> task)
+        {
+            {
+                std::lock_guard lock(mutex_);
+                tasks_.push_back(std::move(task));
+            }
+            ready_.notify_one();
+        }
+
+    private:
+        void run()
+        {
+            for (;;)
+            {
+                std::function<void()> task;
+                {
+                    std::unique_lock lock(mutex_);
+                    ready_.wait(lock, [this] { return stopping_ || !tasks_.empty(); });
+                    if (tasks_.empty())
+                    {
+                        return;
+                    }
+                    task = std::move(tasks_.front());
+                    tasks_.pop_front();
+                }
+                task();
+            }
+        }
+
+        std::mutex mutex_;
+        std::condition_variable ready_;
+        std::deque<std::function<void()>> tasks_;
+        bool stopping_ = false;
+        std::vector<std::thread> workers_;
+    };
+
+    static_assert(executor<thread_pool>);
+}
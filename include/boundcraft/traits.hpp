@@ -1,15 +1,27 @@
 #pragma once
 
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+
 #include "policy.hpp"
+#include <boundcraft/details/aligned-allocator.hpp>
+#include <boundcraft/details/isa.hpp>
+#include <boundcraft/details/simd/simd-scan.hpp>
 
 enum class policy_kind
 {
     standard_binary,
+    branchless,
+    prefetch_binary,
     galloping,
-    hybrid
+    hybrid,
+    interpolation,
+    adaptive,
+    eytzinger
 };
 
-namespace boundcraft::policy::traits
+namespace boundcraft::inline BOUNDCRAFT_ISA::policy::traits
 {
 
     template <class Policy>
@@ -21,6 +33,19 @@ namespace boundcraft::policy::traits
         static constexpr policy_kind kind = policy_kind::standard_binary;
     };
 
+    template <>
+    struct policy_traits<branchless>
+    {
+        static constexpr policy_kind kind = policy_kind::branchless;
+    };
+
+    template <std::size_t L>
+    struct policy_traits<prefetch_binary<L>>
+    {
+        static constexpr policy_kind kind = policy_kind::prefetch_binary;
+        static constexpr std::size_t levels = L;
+    };
+
     template <class Search_Policy, class Gallop_Start>
     struct policy_traits<galloping<Search_Policy, Gallop_Start>>
     {
@@ -35,9 +60,71 @@ namespace boundcraft::policy::traits
         static constexpr policy_kind kind = policy_kind::hybrid;
         static constexpr std::size_t threshold = T;
     };
+
+    // Searches like hybrid; its threshold depends on the element type, see hybrid_threshold.
+    template <>
+    struct policy_traits<hybrid_auto>
+    {
+        static constexpr policy_kind kind = policy_kind::hybrid;
+    };
+
+    template <std::size_t Max_Probes, std::size_t Threshold>
+    struct policy_traits<interpolation<Max_Probes, Threshold>>
+    {
+        static constexpr policy_kind kind = policy_kind::interpolation;
+        static constexpr std::size_t max_probes = Max_Probes;
+        static constexpr std::size_t threshold = Threshold;
+    };
+
+    template <std::size_t P>
+    struct policy_traits<eytzinger<P>>
+    {
+        static constexpr policy_kind kind = policy_kind::eytzinger;
+        static constexpr std::size_t prefetch_levels = P;
+    };
+
+    // Range length at which a hybrid policy switches to its linear scan, for elements of type T.
+    template <class Policy, class T>
+    struct hybrid_threshold;
+
+    template <std::size_t N, class T>
+    struct hybrid_threshold<hybrid<N>, T> : std::integral_constant<std::size_t, N>
+    {
+    };
+
+    // One cache line of elements for scalar scans; two when the SIMD kernel handles T, whose
+    // compares are cheap enough that the extra line still beats the mispredicted probes it saves.
+    template <class T>
+    struct hybrid_threshold<hybrid_auto, T>
+        : std::integral_constant<std::size_t,
+                                 std::max<std::size_t>((boundcraft::detail::simd::is_key_v<T> ? 2 : 1) *
+                                                           boundcraft::detail::target_cache_line_bytes / sizeof(T),
+                                                       1)>
+    {
+    };
+
+    template <class Policy, class T>
+    inline constexpr std::size_t hybrid_threshold_v = hybrid_threshold<Policy, std::remove_cv_t<T>>::value;
+
+    // The policy used once the search range has been bracketed: galloping delegates to its
+    // inner policy, every other policy searches the bracket itself.
+    template <class Policy>
+    struct inner_search_policy
+    {
+        using type = Policy;
+    };
+
+    template <class Search_Policy, class Gallop_Start>
+    struct inner_search_policy<galloping<Search_Policy, Gallop_Start>>
+    {
+        using type = Search_Policy;
+    };
+
+    template <class Policy>
+    using inner_search_policy_t = typename inner_search_policy<Policy>::type;
 };
 
-namespace boundcraft::policy::gallop::traits
+namespace boundcraft::inline BOUNDCRAFT_ISA::policy::gallop::traits
 {
 
     template <class T>
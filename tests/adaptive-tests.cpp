@@ -0,0 +1,236 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <span>
+#include <string>
+#include <vector>
+
+#include <boundcraft/boundcraft.hpp>
+
+#include "test-helpers.hpp"
+
+namespace {
+
+using boundcraft_tests::make_sorted_with_dups;
+
+using boundcraft::adaptive_kernel;
+using boundcraft::adaptive_table;
+
+template <class T>
+void expect_matches_std(const std::vector<T>& v, T q)
+{
+    boundcraft::searcher<boundcraft::policy::adaptive> s;
+    ASSERT_EQ(s.lower_bound(v.begin(), v.end(), q) - v.begin(), std::lower_bound(v.begin(), v.end(), q) - v.begin()) << "q=" << q;
+    ASSERT_EQ(s.upper_bound(v.begin(), v.end(), q) - v.begin(), std::upper_bound(v.begin(), v.end(), q) - v.begin()) << "q=" << q;
+}
+
+adaptive_table uniform_table(adaptive_kernel kernel)
+{
+    adaptive_table table;
+    for (std::size_t b = 0; b < adaptive_table::buckets; ++b) table.set(b, kernel);
+    return table;
+}
+
+// Installs `table` for both directions and both orders of T.
+template <class T>
+void load_everywhere(const adaptive_table& table)
+{
+    using boundcraft::adaptive_order;
+    using boundcraft::adaptive_search;
+    boundcraft::adaptive_tuning<T, adaptive_search::lower_bound, adaptive_order::ascending>::load(table);
+    boundcraft::adaptive_tuning<T, adaptive_search::upper_bound, adaptive_order::ascending>::load(table);
+    boundcraft::adaptive_tuning<T, adaptive_search::lower_bound, adaptive_order::descending>::load(table);
+    boundcraft::adaptive_tuning<T, adaptive_search::upper_bound, adaptive_order::descending>::load(table);
+}
+
+TEST(AdaptiveTable, BucketsByFloorLog2)
+{
+    EXPECT_EQ(adaptive_table::bucket_of(0), 0u);
+    EXPECT_EQ(adaptive_table::bucket_of(1), 0u);
+    EXPECT_EQ(adaptive_table::bucket_of(2), 1u);
+    EXPECT_EQ(adaptive_table::bucket_of(3), 1u);
+    EXPECT_EQ(adaptive_table::bucket_of(1024), 10u);
+    EXPECT_EQ(adaptive_table::bucket_of(SIZE_MAX), 63u);
+}
+
+TEST(AdaptiveTable, SerializeRoundTrips)
+{
+    adaptive_table table;
+    for (std::size_t b = 0; b < adaptive_table::buckets; ++b)
+    {
+        table.set(b, static_cast<adaptive_kernel>(b % boundcraft::adaptive_kernel_count));
+    }
+
+    const std::string text = table.serialize();
+    EXPECT_TRUE(text.starts_with(adaptive_table::format_tag));
+
+    auto parsed = adaptive_table::parse(text);
+    ASSERT_TRUE(parsed.has_value());
+    EXPECT_EQ(*parsed, table);
+
+    parsed = adaptive_table::parse(text + "\n");
+    ASSERT_TRUE(parsed.has_value());
+    EXPECT_EQ(*parsed, table);
+}
+
+TEST(AdaptiveTable, ParseRejectsMalformedText)
+{
+    const std::string good = adaptive_table{}.serialize();
+    EXPECT_FALSE(adaptive_table::parse("").has_value());
+    EXPECT_FALSE(adaptive_table::parse(good.substr(0, good.size() - 1)).has_value());
+    EXPECT_FALSE(adaptive_table::parse(good + "2").has_value());
+
+    std::string bad_tag = good;
+    bad_tag[0] = 'x';
+    EXPECT_FALSE(adaptive_table::parse(bad_tag).has_value());
+
+    std::string bad_digit = good;
+    bad_digit.back() = '9';
+    EXPECT_FALSE(adaptive_table::parse(bad_digit).has_value());
+}
+
+TEST(AdaptiveTuning, CalibrateInstallsTheMeasuredTable)
+{
+    using tuning = boundcraft::adaptive_tuning<std::uint16_t>;
+    const adaptive_table table = tuning::calibrate({.max_log2 = 10, .queries = 64, .rounds = 1});
+
+    EXPECT_TRUE(tuning::calibrated());
+    EXPECT_EQ(tuning::table(), table);
+    for (std::size_t b = 11; b < adaptive_table::buckets; ++b)
+    {
+        EXPECT_EQ(table[b], table[10]) << "b=" << b;
+    }
+}
+
+TEST(AdaptiveTuning, LoadedTableIsUsedAsIs)
+{
+    using tuning = boundcraft::adaptive_tuning<std::int8_t>;
+    auto table = uniform_table(adaptive_kernel::branchless);
+    table.set(3, adaptive_kernel::gallop_middle);
+    tuning::load(table);
+
+    EXPECT_TRUE(tuning::calibrated());
+    EXPECT_EQ(tuning::table(), table);
+    EXPECT_EQ(tuning::kernel_for(9), adaptive_kernel::gallop_middle);
+    EXPECT_EQ(tuning::kernel_for(100), adaptive_kernel::branchless);
+
+    // A saved table survives a text round trip into another process.
+    EXPECT_EQ(adaptive_table::parse(tuning::table().serialize()), table);
+}
+
+TEST(AdaptivePolicy, EveryKernelMatchesStd)
+{
+    for (std::size_t k = 0; k < boundcraft::adaptive_kernel_count; ++k)
+    {
+        load_everywhere<std::int64_t>(uniform_table(static_cast<adaptive_kernel>(k)));
+        for (std::size_t n : {0u, 1u, 5u, 64u, 1000u})
+        {
+            const auto v = make_sorted_with_dups<std::int64_t>(n, -300, 300, static_cast<std::uint32_t>(n + k));
+            for (std::int64_t q = -302; q <= 302; q += 7)
+            {
+                expect_matches_std(v, q);
+            }
+        }
+    }
+}
+
+TEST(AdaptivePolicy, FirstUseCalibratesAndMatchesStd)
+{
+    const auto v = make_sorted_with_dups<double>(20000, -5000, 5000, 4u);
+    for (double q = -5001.0; q <= 5001.0; q += 13.5)
+    {
+        expect_matches_std(v, q);
+    }
+    EXPECT_TRUE(boundcraft::adaptive_tuning<double>::calibrated());
+}
+
+TEST(AdaptivePolicy, GallopedBracketsAndEqualRangesUseTheTable)
+{
+    using galloping = boundcraft::policy::galloping<boundcraft::policy::adaptive, boundcraft::policy::gallop::start_middle>;
+    const auto v = make_sorted_with_dups<std::int32_t>(5000, -2000, 2000, 21u);
+
+    std::vector<std::int32_t> keys;
+    for (std::int32_t q = -2003; q <= 2003; q += 9) keys.push_back(q);
+
+    for (std::size_t k = 0; k < boundcraft::adaptive_kernel_count; ++k)
+    {
+        load_everywhere<std::int32_t>(uniform_table(static_cast<adaptive_kernel>(k)));
+        boundcraft::searcher<galloping> s;
+        for (std::int32_t q : keys)
+        {
+            ASSERT_EQ(s.lower_bound(v.begin(), v.end(), q) - v.begin(), std::lower_bound(v.begin(), v.end(), q) - v.begin()) << "k=" << k << " q=" << q;
+            ASSERT_EQ(s.upper_bound(v.begin(), v.end(), q) - v.begin(), std::upper_bound(v.begin(), v.end(), q) - v.begin()) << "k=" << k << " q=" << q;
+        }
+
+        boundcraft::searcher<boundcraft::policy::adaptive> batch;
+        for (std::int32_t q : keys)
+        {
+            const auto [lo, hi] = batch.equal_range(v.begin(), v.end(), q);
+            const auto [elo, ehi] = std::equal_range(v.begin(), v.end(), q);
+            ASSERT_EQ(lo, elo) << "k=" << k << " q=" << q;
+            ASSERT_EQ(hi, ehi) << "k=" << k << " q=" << q;
+        }
+
+        std::vector<std::vector<std::int32_t>::const_iterator> lo(keys.size()), hi(keys.size());
+        batch.lower_bound_sorted_batch(v.cbegin(), v.cend(), std::span<const std::int32_t>(keys), std::span(lo));
+        batch.upper_bound_sorted_batch(v.cbegin(), v.cend(), std::span<const std::int32_t>(keys), std::span(hi));
+        for (std::size_t i = 0; i < keys.size(); ++i)
+        {
+            ASSERT_EQ(lo[i], std::lower_bound(v.cbegin(), v.cend(), keys[i])) << "k=" << k << " q=" << keys[i];
+            ASSERT_EQ(hi[i], std::upper_bound(v.cbegin(), v.cend(), keys[i])) << "k=" << k << " q=" << keys[i];
+        }
+    }
+}
+
+TEST(AdaptiveTuning, WarmUpCalibratesEveryDirectionAndOrder)
+{
+    using boundcraft::adaptive_order;
+    using boundcraft::adaptive_search;
+    using T = std::int16_t;
+
+    boundcraft::adaptive_warm_up<T>({.max_log2 = 8, .queries = 32, .rounds = 1});
+    EXPECT_TRUE((boundcraft::adaptive_tuning<T, adaptive_search::lower_bound, adaptive_order::ascending>::calibrated()));
+    EXPECT_TRUE((boundcraft::adaptive_tuning<T, adaptive_search::upper_bound, adaptive_order::ascending>::calibrated()));
+    EXPECT_TRUE((boundcraft::adaptive_tuning<T, adaptive_search::lower_bound, adaptive_order::descending>::calibrated()));
+    EXPECT_TRUE((boundcraft::adaptive_tuning<T, adaptive_search::upper_bound, adaptive_order::descending>::calibrated()));
+}
+
+TEST(AdaptivePolicy, DescendingSearchesUseTheirOwnTables)
+{
+    using boundcraft::adaptive_order;
+    using boundcraft::adaptive_search;
+    using T = std::uint64_t;
+    using lower_desc = boundcraft::adaptive_tuning<T, adaptive_search::lower_bound, adaptive_order::descending>;
+    using upper_desc = boundcraft::adaptive_tuning<T, adaptive_search::upper_bound, adaptive_order::descending>;
+
+    lower_desc::load(uniform_table(adaptive_kernel::branchless));
+    upper_desc::load(uniform_table(adaptive_kernel::gallop_middle));
+
+    auto v = make_sorted_with_dups<T>(3000, 0, 700, 23u);
+    std::reverse(v.begin(), v.end());
+    boundcraft::searcher<boundcraft::policy::adaptive> s;
+    for (T q = 0; q <= 702; ++q)
+    {
+        ASSERT_EQ(s.lower_bound(v.begin(), v.end(), q, std::greater<>{}), std::lower_bound(v.begin(), v.end(), q, std::greater<>{})) << "q=" << q;
+        ASSERT_EQ(s.upper_bound(v.begin(), v.end(), q, std::greater<>{}), std::upper_bound(v.begin(), v.end(), q, std::greater<>{})) << "q=" << q;
+    }
+
+    // std::greater searches found their tables and never calibrated the std::less ones.
+    EXPECT_FALSE((boundcraft::adaptive_tuning<T, adaptive_search::lower_bound, adaptive_order::ascending>::calibrated()));
+    EXPECT_FALSE((boundcraft::adaptive_tuning<T, adaptive_search::upper_bound, adaptive_order::ascending>::calibrated()));
+}
+
+TEST(AdaptivePolicy, NonArithmeticKeysSearchLikeHybrid)
+{
+    std::vector<std::string> v = {"apple", "banana", "banana", "cherry", "kiwi", "pear"};
+    for (std::string q : {"", "banana", "c", "kiwi", "zzz"})
+    {
+        expect_matches_std(v, q);
+    }
+}
+
+} // namespace
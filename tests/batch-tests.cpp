@@ -0,0 +1,226 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <forward_list>
+#include <functional>
+#include <random>
+#include <span>
+#include <vector>
+
+#include <boundcraft/boundcraft.hpp>
+
+#include "test-helpers.hpp"
+
+namespace {
+
+using boundcraft_tests::make_sorted_with_dups;
+
+std::vector<int> make_queries(std::size_t m, int minv, int maxv, std::uint32_t seed)
+{
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> dist(minv, maxv);
+    std::vector<int> q(m);
+    for (auto& x : q) x = dist(rng);
+    return q;
+}
+
+namespace gallop = boundcraft::policy::gallop;
+
+template <class Policy>
+class BatchSearchTests : public ::testing::Test {};
+
+using BatchPolicies = ::testing::Types<
+    boundcraft::policy::standard_binary,
+    boundcraft::policy::branchless,
+    boundcraft::policy::hybrid<4>,
+    boundcraft::policy::hybrid<64>,
+    boundcraft::policy::hybrid_auto,
+    boundcraft::policy::galloping<boundcraft::policy::standard_binary, gallop::start_middle>,
+    boundcraft::policy::galloping<boundcraft::policy::hybrid<16>, gallop::start_front>
+>;
+TYPED_TEST_SUITE(BatchSearchTests, BatchPolicies);
+
+TYPED_TEST(BatchSearchTests, EmptyRangeAndEmptyKeys)
+{
+    boundcraft::searcher<TypeParam> s;
+    std::vector<int> v;
+    std::vector<int> keys{1, 2, 3};
+    std::vector<const int*> out(keys.size(), nullptr);
+
+    s.lower_bound_batch(std::span<const int>(v), std::span<const int>(keys), std::span<const int*>(out));
+    for (auto* p : out) EXPECT_EQ(p, v.data());
+
+    std::vector<int> w{1, 2, 3};
+    s.upper_bound_batch(std::span<const int>(w), std::span<const int>(), std::span<const int*>());
+}
+
+TYPED_TEST(BatchSearchTests, SpanBatchMatchesStd)
+{
+    boundcraft::searcher<TypeParam> s;
+
+    for (std::size_t n : {1u, 2u, 17u, 1000u, 4097u})
+    {
+        auto v = make_sorted_with_dups(n, -500, 500, static_cast<std::uint32_t>(n));
+        // Not a multiple of the group size, so the last group is partial.
+        auto keys = make_queries(1003, -600, 600, 7u);
+
+        std::vector<const int*> lo(keys.size()), hi(keys.size());
+        s.lower_bound_batch(std::span<const int>(v), std::span<const int>(keys), std::span<const int*>(lo));
+        s.upper_bound_batch(std::span<const int>(v), std::span<const int>(keys), std::span<const int*>(hi));
+
+        for (std::size_t i = 0; i < keys.size(); ++i)
+        {
+            ASSERT_EQ(lo[i] - v.data(), std::lower_bound(v.begin(), v.end(), keys[i]) - v.begin());
+            ASSERT_EQ(hi[i] - v.data(), std::upper_bound(v.begin(), v.end(), keys[i]) - v.begin());
+        }
+    }
+}
+
+TYPED_TEST(BatchSearchTests, IteratorBatchWithComparator)
+{
+    boundcraft::searcher<TypeParam> s;
+
+    auto v = make_sorted_with_dups(3000, -100, 100, 3u);
+    std::reverse(v.begin(), v.end());
+    auto keys = make_queries(257, -110, 110, 4u);
+
+    using It = std::vector<int>::iterator;
+    std::vector<It> lo(keys.size()), hi(keys.size());
+    s.lower_bound_batch(v.begin(), v.end(), std::span<const int>(keys), std::span<It>(lo), std::greater<>{});
+    s.upper_bound_batch(v.begin(), v.end(), std::span<const int>(keys), std::span<It>(hi), std::greater<>{});
+
+    for (std::size_t i = 0; i < keys.size(); ++i)
+    {
+        ASSERT_EQ(lo[i], std::lower_bound(v.begin(), v.end(), keys[i], std::greater<>{}));
+        ASSERT_EQ(hi[i], std::upper_bound(v.begin(), v.end(), keys[i], std::greater<>{}));
+    }
+}
+
+TEST(BatchSearchForward, ForwardIteratorsFallBackToSingleSearches)
+{
+    std::forward_list<int> fl{1, 2, 2, 4, 7, 9};
+    std::vector<int> keys{0, 2, 3, 9, 10};
+
+    using It = std::forward_list<int>::iterator;
+    std::vector<It> out(keys.size());
+
+    boundcraft::searcher<boundcraft::policy::hybrid<2>> s;
+    s.lower_bound_batch(fl.begin(), fl.end(), std::span<const int>(keys), std::span<It>(out));
+
+    for (std::size_t i = 0; i < keys.size(); ++i)
+    {
+        EXPECT_EQ(out[i], std::lower_bound(fl.begin(), fl.end(), keys[i]));
+    }
+}
+
+// ------------------------------------------------------------
+// Sorted-key batches (gallop from the previous answer)
+// ------------------------------------------------------------
+
+template <class Policy>
+class SortedBatchTests : public ::testing::Test {};
+
+TYPED_TEST_SUITE(SortedBatchTests, BatchPolicies);
+
+TYPED_TEST(SortedBatchTests, AscendingKeysMatchStd)
+{
+    boundcraft::searcher<TypeParam> s;
+
+    for (std::size_t n : {0u, 1u, 5u, 300u, 10000u})
+    {
+        auto v = make_sorted_with_dups(n, -1000, 1000, static_cast<std::uint32_t>(n + 1));
+
+        for (std::size_t m : {1u, 7u, 64u, 2500u})
+        {
+            auto keys = make_queries(m, -1100, 1100, static_cast<std::uint32_t>(m));
+            std::sort(keys.begin(), keys.end());
+
+            std::vector<const int*> lo(m), hi(m);
+            s.lower_bound_sorted_batch(std::span<const int>(v), std::span<const int>(keys), std::span<const int*>(lo));
+            s.upper_bound_sorted_batch(std::span<const int>(v), std::span<const int>(keys), std::span<const int*>(hi));
+
+            for (std::size_t i = 0; i < m; ++i)
+            {
+                ASSERT_EQ(lo[i] - v.data(), std::lower_bound(v.begin(), v.end(), keys[i]) - v.begin());
+                ASSERT_EQ(hi[i] - v.data(), std::upper_bound(v.begin(), v.end(), keys[i]) - v.begin());
+            }
+        }
+    }
+}
+
+TYPED_TEST(SortedBatchTests, DescendingKeysMatchStd)
+{
+    boundcraft::searcher<TypeParam> s;
+
+    for (std::size_t n : {0u, 1u, 5u, 300u, 10000u})
+    {
+        auto v = make_sorted_with_dups(n, -1000, 1000, static_cast<std::uint32_t>(n + 2));
+
+        for (std::size_t m : {1u, 7u, 64u, 2500u})
+        {
+            auto keys = make_queries(m, -1100, 1100, static_cast<std::uint32_t>(m + 3));
+            std::sort(keys.begin(), keys.end(), std::greater<>{});
+
+            using It = std::vector<int>::iterator;
+            std::vector<It> lo(m), hi(m);
+            s.lower_bound_sorted_batch(v.begin(), v.end(), std::span<const int>(keys), std::span<It>(lo),
+                                       boundcraft::key_order::descending);
+            s.upper_bound_sorted_batch(v.begin(), v.end(), std::span<const int>(keys), std::span<It>(hi),
+                                       boundcraft::key_order::descending);
+
+            for (std::size_t i = 0; i < m; ++i)
+            {
+                ASSERT_EQ(lo[i], std::lower_bound(v.begin(), v.end(), keys[i]));
+                ASSERT_EQ(hi[i], std::upper_bound(v.begin(), v.end(), keys[i]));
+            }
+        }
+    }
+}
+
+TYPED_TEST(SortedBatchTests, GreaterComparatorOnDescendingData)
+{
+    boundcraft::searcher<TypeParam> s;
+
+    auto v = make_sorted_with_dups(4000, -200, 200, 21u);
+    std::reverse(v.begin(), v.end());
+
+    // Ascending with respect to std::greater<> means numerically decreasing keys.
+    auto keys = make_queries(500, -210, 210, 22u);
+    std::sort(keys.begin(), keys.end(), std::greater<>{});
+
+    std::vector<int*> lo(keys.size()), hi(keys.size());
+    s.lower_bound_sorted_batch(std::span<int>(v), std::span<const int>(keys), std::span<int*>(lo), std::greater<>{});
+    s.upper_bound_sorted_batch(std::span<int>(v), std::span<const int>(keys), std::span<int*>(hi), std::greater<>{});
+
+    for (std::size_t i = 0; i < keys.size(); ++i)
+    {
+        ASSERT_EQ(lo[i] - v.data(), std::lower_bound(v.begin(), v.end(), keys[i], std::greater<>{}) - v.begin());
+        ASSERT_EQ(hi[i] - v.data(), std::upper_bound(v.begin(), v.end(), keys[i], std::greater<>{}) - v.begin());
+    }
+}
+
+TEST(SortedBatchCost, DenseSortedKeysUseFewComparisons)
+{
+    std::vector<int> v(1 << 20);
+    for (std::size_t i = 0; i < v.size(); ++i) v[i] = static_cast<int>(i);
+
+    std::vector<int> keys(1 << 12);
+    for (std::size_t i = 0; i < keys.size(); ++i) keys[i] = static_cast<int>(i * 256 + 7);
+
+    std::size_t calls = 0;
+    auto counting = [&calls](int a, int b) { ++calls; return a < b; };
+
+    std::vector<const int*> out(keys.size());
+    boundcraft::searcher<boundcraft::policy::standard_binary> s;
+    s.lower_bound_sorted_batch(std::span<const int>(v), std::span<const int>(keys), std::span<const int*>(out), counting);
+
+    for (std::size_t i = 0; i < keys.size(); ++i) ASSERT_EQ(*out[i], keys[i]);
+
+    // n/m = 256: about 2*log2(256) + 2 comparisons per key, well under the
+    // 20 probes per key of independent searches over 2^20 elements.
+    EXPECT_LE(calls, keys.size() * 18);
+}
+
+} // namespace
@@ -0,0 +1,150 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <span>
+#include <vector>
+
+#include <boundcraft/boundcraft.hpp>
+
+#include "test-helpers.hpp"
+
+namespace {
+
+using boundcraft_tests::make_sorted_with_dups;
+using boundcraft_tests::expect_matches_std;
+
+template <class T>
+void expect_round_trip(const boundcraft::compressed_array<T>& array, std::span<const T> v)
+{
+    ASSERT_EQ(array.size(), v.size());
+    for (std::size_t i = 0; i < v.size(); ++i)
+    {
+        ASSERT_EQ(array[i], v[i]) << "i=" << i;
+    }
+}
+
+template <class T>
+void expect_probes_match_std(const boundcraft::compressed_array<T>& array, std::span<const T> v)
+{
+    for (T x : v)
+    {
+        expect_matches_std(array, v, x);
+        expect_matches_std(array, v, static_cast<T>(x + 1));
+        if (x > 0) expect_matches_std(array, v, static_cast<T>(x - 1));
+    }
+    expect_matches_std(array, v, T{0});
+    expect_matches_std(array, v, std::numeric_limits<T>::max());
+}
+
+TEST(BitPack, RoundTripsEveryWidth)
+{
+    namespace bp = boundcraft::detail::bitpack;
+    std::mt19937 rng(5u);
+
+    for (unsigned bits = 0; bits <= 32; ++bits)
+    {
+        const std::uint32_t mask = bits == 32 ? ~std::uint32_t{0} : (std::uint32_t{1} << bits) - 1;
+        std::vector<std::uint32_t> values(bp::block_values);
+        for (auto& x : values) x = static_cast<std::uint32_t>(rng()) & mask;
+
+        std::vector<std::uint32_t> words(bp::packed_words(bits) + 1, 0);
+        bp::pack(values.data(), bits, words.data());
+        ASSERT_EQ(words.back(), 0u) << "bits=" << bits;
+
+        std::vector<std::uint32_t> out(bp::block_values, 0xdeadbeef);
+        bp::unpack(words.data(), bits, out.data());
+        for (std::size_t e = 0; e < bp::block_values; ++e)
+        {
+            ASSERT_EQ(out[e], values[e]) << "bits=" << bits << " e=" << e;
+            ASSERT_EQ(bp::extract(words.data(), bits, e), values[e]) << "bits=" << bits << " e=" << e;
+        }
+    }
+}
+
+template <class T>
+class CompressedArrayTests : public ::testing::Test {};
+
+using CompressedKeys = ::testing::Types<std::uint32_t, std::uint64_t>;
+TYPED_TEST_SUITE(CompressedArrayTests, CompressedKeys);
+
+TYPED_TEST(CompressedArrayTests, EmptyArray)
+{
+    boundcraft::compressed_array<TypeParam> array(std::span<const TypeParam>{});
+    EXPECT_TRUE(array.empty());
+    EXPECT_EQ(array.block_count(), 0u);
+    EXPECT_EQ(array.lower_bound(TypeParam(1)), 0u);
+    EXPECT_EQ(array.upper_bound(TypeParam(1)), 0u);
+}
+
+TYPED_TEST(CompressedArrayTests, MatchesStdAroundBlockBoundaries)
+{
+    using T = TypeParam;
+    for (std::size_t n : {1u, 2u, 127u, 128u, 129u, 255u, 256u, 257u, 1000u})
+    {
+        auto v = make_sorted_with_dups<T>(n, 10, 5000, static_cast<std::uint32_t>(n));
+        boundcraft::compressed_array<T> array{std::span<const T>(v)};
+
+        EXPECT_EQ(array.block_count(), (n + 127) / 128);
+        expect_round_trip(array, std::span<const T>(v));
+        expect_probes_match_std(array, std::span<const T>(v));
+    }
+}
+
+TYPED_TEST(CompressedArrayTests, HeavyDuplicatesAndConstantBlocks)
+{
+    using T = TypeParam;
+    std::vector<T> v(1000, T{42});
+    v.insert(v.end(), 300, T{43});
+    v.insert(v.end(), 5, T{1000000});
+    boundcraft::compressed_array<T> array{std::span<const T>(v)};
+
+    expect_round_trip(array, std::span<const T>(v));
+    expect_probes_match_std(array, std::span<const T>(v));
+}
+
+TYPED_TEST(CompressedArrayTests, FullRangeKeys)
+{
+    using T = TypeParam;
+    auto v = make_sorted_with_dups<T>(5000, T{0}, std::numeric_limits<T>::max(), 11u);
+    v.push_back(std::numeric_limits<T>::max());
+    boundcraft::compressed_array<T> array{std::span<const T>(v)};
+
+    expect_round_trip(array, std::span<const T>(v));
+    expect_probes_match_std(array, std::span<const T>(v));
+}
+
+TYPED_TEST(CompressedArrayTests, CompressesDenseKeys)
+{
+    using T = TypeParam;
+    std::vector<T> v(1 << 16);
+    for (std::size_t i = 0; i < v.size(); ++i) v[i] = static_cast<T>(1000000 + 3 * i);
+    boundcraft::compressed_array<T> array{std::span<const T>(v)};
+
+    // Offsets within a block stay below 3 * 128, so nine bits per key plus a header per block.
+    EXPECT_LT(array.memory_bytes(), v.size() * sizeof(T) / 2);
+    expect_round_trip(array, std::span<const T>(v));
+
+    std::mt19937_64 rng(3u);
+    std::uniform_int_distribution<T> dist(v.front() - 10, v.back() + 10);
+    for (int i = 0; i < 5000; ++i) expect_matches_std(array, std::span<const T>(v), dist(rng));
+}
+
+TEST(CompressedArray, WideUint64BlocksAreStoredRaw)
+{
+    std::vector<std::uint64_t> v;
+    for (std::uint64_t i = 0; i < 400; ++i) v.push_back(i * (std::uint64_t{1} << 40) + i);
+    boundcraft::compressed_array<std::uint64_t, boundcraft::policy::standard_binary> array{std::span<const std::uint64_t>(v)};
+
+    for (std::size_t i = 0; i < v.size(); ++i) ASSERT_EQ(array[i], v[i]);
+    for (std::uint64_t x : v)
+    {
+        ASSERT_EQ(array.lower_bound(x), static_cast<std::size_t>(std::lower_bound(v.begin(), v.end(), x) - v.begin()));
+        ASSERT_EQ(array.upper_bound(x + 1), static_cast<std::size_t>(std::upper_bound(v.begin(), v.end(), x + 1) - v.begin()));
+    }
+}
+
+} // namespace
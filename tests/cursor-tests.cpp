@@ -0,0 +1,127 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <span>
+#include <vector>
+
+#include <boundcraft/boundcraft.hpp>
+
+#include "test-helpers.hpp"
+
+namespace {
+
+using boundcraft_tests::make_sorted_with_dups;
+
+using stdbin = boundcraft::policy::standard_binary;
+using brless = boundcraft::policy::branchless;
+using hyb16 = boundcraft::policy::hybrid<16>;
+using g_hyb16 = boundcraft::policy::galloping<hyb16, boundcraft::policy::gallop::start_front>;
+
+// Counts every comparison so the finger's O(log distance) cost can be checked.
+struct counting_less {
+    std::size_t* calls;
+    bool operator()(int a, int b) const { ++*calls; return a < b; }
+};
+
+template <class Policy>
+class CursorTests : public ::testing::Test {};
+
+using CursorPolicies = ::testing::Types<stdbin, brless, hyb16, g_hyb16>;
+TYPED_TEST_SUITE(CursorTests, CursorPolicies);
+
+TYPED_TEST(CursorTests, EmptyRange)
+{
+    std::vector<int> v;
+    auto c = boundcraft::make_cursor<TypeParam>(v.begin(), v.end());
+
+    EXPECT_EQ(c.lower_bound(3), v.end());
+    EXPECT_EQ(c.upper_bound(3), v.end());
+}
+
+TYPED_TEST(CursorTests, AscendingStreamMatchesStd)
+{
+    auto v = make_sorted_with_dups(2000, -1000, 1000, 11u);
+    auto c = boundcraft::make_cursor<TypeParam>(v.begin(), v.end());
+
+    for (int q = -1010; q <= 1010; q += 3)
+    {
+        EXPECT_EQ(c.lower_bound(q), std::lower_bound(v.begin(), v.end(), q));
+        EXPECT_EQ(c.upper_bound(q), std::upper_bound(v.begin(), v.end(), q));
+    }
+}
+
+TYPED_TEST(CursorTests, RandomStreamMatchesStd)
+{
+    auto v = make_sorted_with_dups(3000, 0, 500, 12u);
+
+    auto c = boundcraft::make_cursor<TypeParam>(std::span<const int>(v));
+
+    std::mt19937 rng(13u);
+    std::uniform_int_distribution<int> qdist(-10, 510);
+    for (int i = 0; i < 2000; ++i)
+    {
+        const int q = qdist(rng);
+        EXPECT_EQ(c.lower_bound(q) - v.data(), std::lower_bound(v.begin(), v.end(), q) - v.begin());
+        EXPECT_EQ(c.upper_bound(q) - v.data(), std::upper_bound(v.begin(), v.end(), q) - v.begin());
+    }
+}
+
+TYPED_TEST(CursorTests, DescendingComparator)
+{
+    auto v = make_sorted_with_dups(700, -300, 300, 14u);
+    std::reverse(v.begin(), v.end());
+
+    auto c = boundcraft::make_cursor<TypeParam>(v.begin(), v.end());
+    for (int q = 310; q >= -310; q -= 7)
+    {
+        EXPECT_EQ(c.lower_bound(q, std::greater<>{}), std::lower_bound(v.begin(), v.end(), q, std::greater<>{}));
+        EXPECT_EQ(c.upper_bound(q, std::greater<>{}), std::upper_bound(v.begin(), v.end(), q, std::greater<>{}));
+    }
+}
+
+TEST(CursorFinger, RemembersPreviousResult)
+{
+    std::vector<int> v{1, 3, 5, 7, 9, 11};
+    auto c = boundcraft::make_cursor<stdbin>(v.begin(), v.end());
+
+    EXPECT_EQ(c.position(), v.begin());
+    c.lower_bound(7);
+    EXPECT_EQ(c.position(), v.begin() + 3);
+    c.lower_bound(100);
+    EXPECT_EQ(c.position(), v.end());
+    EXPECT_EQ(c.lower_bound(2), v.begin() + 1);
+
+    c.reset();
+    EXPECT_EQ(c.position(), v.begin());
+    c.seek(v.begin() + 4);
+    EXPECT_EQ(c.lower_bound(9), v.begin() + 4);
+}
+
+TEST(CursorFinger, SortedStreamCostsLogDistance)
+{
+    std::vector<int> v(1 << 20);
+    for (std::size_t i = 0; i < v.size(); ++i) v[i] = static_cast<int>(2 * i);
+
+    std::size_t calls = 0;
+    auto c = boundcraft::make_cursor<stdbin>(v.begin(), v.end());
+
+    constexpr int stride = 16;
+    constexpr int lookups = 4096;
+    for (int i = 0; i < lookups; ++i)
+    {
+        const int q = 2 * stride * i + 1;
+        ASSERT_EQ(c.lower_bound(q, counting_less{&calls}), std::lower_bound(v.begin(), v.end(), q));
+    }
+
+    // Galloping over a gap of `stride` takes about 2*log2(stride) comparisons,
+    // far below the log2(n) = 20 of a search over the whole range.
+    const double per_lookup = static_cast<double>(calls) / lookups;
+    EXPECT_LE(per_lookup, 2.0 * std::log2(stride) + 3.0);
+}
+
+} // namespace
@@ -0,0 +1,129 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <span>
+#include <vector>
+
+#include <boundcraft/boundcraft.hpp>
+
+#include "test-helpers.hpp"
+
+namespace {
+
+using boundcraft_tests::make_sorted_with_dups;
+using boundcraft_tests::expect_matches_std;
+
+template <class T>
+void expect_probes_match_std(const boundcraft::elias_fano<T>& ef, std::span<const T> v)
+{
+    ASSERT_EQ(ef.size(), v.size());
+    for (std::size_t i = 0; i < v.size(); ++i)
+    {
+        ASSERT_EQ(ef[i], v[i]) << "i=" << i;
+        expect_matches_std(ef, v, v[i]);
+        expect_matches_std(ef, v, static_cast<T>(v[i] + 1));
+        if (v[i] > 0) expect_matches_std(ef, v, static_cast<T>(v[i] - 1));
+    }
+    expect_matches_std(ef, v, T{0});
+    expect_matches_std(ef, v, std::numeric_limits<T>::max());
+}
+
+template <class T>
+class EliasFanoTests : public ::testing::Test {};
+
+using EliasFanoKeys = ::testing::Types<std::uint16_t, std::uint32_t, std::uint64_t>;
+TYPED_TEST_SUITE(EliasFanoTests, EliasFanoKeys);
+
+TYPED_TEST(EliasFanoTests, EmptySequence)
+{
+    boundcraft::elias_fano<TypeParam> ef(std::span<const TypeParam>{});
+    EXPECT_TRUE(ef.empty());
+    EXPECT_EQ(ef.lower_bound(TypeParam(1)), 0u);
+    EXPECT_EQ(ef.upper_bound(TypeParam(1)), 0u);
+
+    auto c = ef.make_cursor();
+    EXPECT_TRUE(c.at_end());
+    EXPECT_EQ(c.lower_bound(TypeParam(1)), 0u);
+}
+
+TYPED_TEST(EliasFanoTests, MatchesStdAcrossDensities)
+{
+    using T = TypeParam;
+    for (T maxv : {T{3}, T{1000}, T{60000}, std::numeric_limits<T>::max()})
+    {
+        for (std::size_t n : {1u, 2u, 63u, 64u, 65u, 300u, 3000u})
+        {
+            auto v = make_sorted_with_dups<T>(n, T{0}, maxv, static_cast<std::uint32_t>(n));
+            boundcraft::elias_fano<T> ef{std::span<const T>(v)};
+            expect_probes_match_std(ef, std::span<const T>(v));
+        }
+    }
+}
+
+TYPED_TEST(EliasFanoTests, LongRunsOfDuplicates)
+{
+    using T = TypeParam;
+    std::vector<T> v(2000, T{7});
+    v.insert(v.end(), 1000, T{9});
+    v.insert(v.end(), 700, T{20000});
+    boundcraft::elias_fano<T> ef{std::span<const T>(v)};
+    expect_probes_match_std(ef, std::span<const T>(v));
+}
+
+TEST(EliasFano, SpaceNearTwoPlusLogUniverseOverN)
+{
+    auto v = make_sorted_with_dups<std::uint32_t>(1 << 16, 0u, 1u << 24, 3u);
+    boundcraft::elias_fano<std::uint32_t> ef{std::span<const std::uint32_t>(v)};
+
+    // floor(log2(max / n)) low bits (max sits just under 2^24), about 2 high bits per element,
+    // plus a little for the select samples.
+    EXPECT_EQ(ef.low_bits(), 7u);
+    EXPECT_LT(ef.memory_bytes() * 8, v.size() * 11);
+}
+
+TEST(EliasFano, CursorStepsThroughEveryElement)
+{
+    auto v = make_sorted_with_dups<std::uint32_t>(5000, 0u, 100000u, 5u);
+    boundcraft::elias_fano<std::uint32_t> ef{std::span<const std::uint32_t>(v)};
+
+    auto c = ef.make_cursor();
+    for (std::size_t i = 0; i < v.size(); ++i, c.next())
+    {
+        ASSERT_FALSE(c.at_end());
+        ASSERT_EQ(c.position(), i);
+        ASSERT_EQ(c.value(), v[i]);
+    }
+    EXPECT_TRUE(c.at_end());
+}
+
+TEST(EliasFano, CursorSkipsMatchStdForIncreasingProbes)
+{
+    auto v = make_sorted_with_dups<std::uint64_t>(20000, 0u, 1u << 22, 9u);
+    boundcraft::elias_fano<std::uint64_t> ef{std::span<const std::uint64_t>(v)};
+
+    for (std::uint64_t max_step : {1u, 40u, 3000u, 1u << 20})
+    {
+        std::mt19937_64 rng(max_step);
+        std::uniform_int_distribution<std::uint64_t> step(0, max_step);
+
+        auto lower = ef.make_cursor();
+        auto upper = ef.make_cursor();
+        for (std::uint64_t q = 0; q <= v.back() + max_step; q += step(rng))
+        {
+            ASSERT_EQ(lower.lower_bound(q), static_cast<std::size_t>(std::lower_bound(v.begin(), v.end(), q) - v.begin())) << "q=" << q;
+            ASSERT_EQ(upper.upper_bound(q), static_cast<std::size_t>(std::upper_bound(v.begin(), v.end(), q) - v.begin())) << "q=" << q;
+            if (!lower.at_end())
+            {
+                ASSERT_EQ(lower.value(), v[lower.position()]);
+            }
+        }
+        EXPECT_TRUE(lower.at_end());
+        EXPECT_TRUE(upper.at_end());
+    }
+}
+
+} // namespace
@@ -0,0 +1,155 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <forward_list>
+#include <functional>
+#include <iterator>
+#include <random>
+#include <span>
+#include <vector>
+
+#include <boundcraft/boundcraft.hpp>
+
+#include "test-helpers.hpp"
+
+namespace {
+
+using boundcraft_tests::make_sorted_with_dups;
+
+template <class Policy, class Comp = std::less<>>
+void check_er(const std::vector<int>& v, int q, Comp comp = {})
+{
+    boundcraft::searcher<Policy> s;
+
+    auto [lo, hi] = s.equal_range(v.begin(), v.end(), q, comp);
+    auto [elo, ehi] = std::equal_range(v.begin(), v.end(), q, comp);
+    ASSERT_EQ(lo - v.begin(), elo - v.begin()) << "q=" << q;
+    ASSERT_EQ(hi - v.begin(), ehi - v.begin()) << "q=" << q;
+
+    auto [plo, phi] = s.equal_range(std::span<const int>(v), q, comp);
+    ASSERT_EQ(plo - v.data(), elo - v.begin()) << "q=" << q;
+    ASSERT_EQ(phi - v.data(), ehi - v.begin()) << "q=" << q;
+}
+
+namespace gallop = boundcraft::policy::gallop;
+
+template <class Policy>
+class EqualRangeTests : public ::testing::Test {};
+
+using EqualRangePolicies = ::testing::Types<
+    boundcraft::policy::standard_binary,
+    boundcraft::policy::branchless,
+    boundcraft::policy::prefetch_binary<2>,
+    boundcraft::policy::hybrid<1>,
+    boundcraft::policy::hybrid<16>,
+    boundcraft::policy::hybrid<64>,
+    boundcraft::policy::hybrid_auto,
+    boundcraft::policy::interpolation<>,
+    boundcraft::policy::adaptive,
+    boundcraft::policy::galloping<boundcraft::policy::standard_binary, gallop::start_front>,
+    boundcraft::policy::galloping<boundcraft::policy::hybrid<16>, gallop::start_back>,
+    boundcraft::policy::galloping<boundcraft::policy::branchless, gallop::start_middle>,
+    boundcraft::policy::galloping<boundcraft::policy::prefetch_binary<1>, gallop::start_front>
+>;
+TYPED_TEST_SUITE(EqualRangeTests, EqualRangePolicies);
+
+TYPED_TEST(EqualRangeTests, EmptyAndSingle)
+{
+    check_er<TypeParam>({}, 3);
+    for (int q : {2, 3, 4})
+    {
+        check_er<TypeParam>({3}, q);
+    }
+}
+
+TYPED_TEST(EqualRangeTests, AllEqual)
+{
+    std::vector<int> v(300, 7);
+    for (int q : {6, 7, 8})
+    {
+        check_er<TypeParam>(v, q);
+    }
+}
+
+TYPED_TEST(EqualRangeTests, MatchesStdAscending)
+{
+    for (std::size_t n : {2u, 5u, 16u, 17u, 64u, 65u, 1000u})
+    {
+        auto v = make_sorted_with_dups(n, 0, static_cast<int>(n / 4 + 1), static_cast<std::uint32_t>(n));
+        for (int q = -1; q <= static_cast<int>(n / 4 + 2); ++q)
+        {
+            check_er<TypeParam>(v, q);
+        }
+    }
+}
+
+TYPED_TEST(EqualRangeTests, MatchesStdDescending)
+{
+    auto v = make_sorted_with_dups(500, -50, 50, 11u);
+    std::reverse(v.begin(), v.end());
+    for (int q = -52; q <= 52; ++q)
+    {
+        check_er<TypeParam>(v, q, std::greater<>{});
+    }
+}
+
+template <class Policy>
+class EqualRangeForwardIterators : public ::testing::Test {};
+
+using ForwardPolicies = ::testing::Types<
+    boundcraft::policy::standard_binary,
+    boundcraft::policy::prefetch_binary<1>,
+    boundcraft::policy::hybrid<4>,
+    boundcraft::policy::interpolation<>,
+    boundcraft::policy::adaptive
+>;
+TYPED_TEST_SUITE(EqualRangeForwardIterators, ForwardPolicies);
+
+TYPED_TEST(EqualRangeForwardIterators, ForwardListMatchesStd)
+{
+    auto v = make_sorted_with_dups(120, 0, 20, 3u);
+    std::forward_list<int> fl(v.begin(), v.end());
+    boundcraft::searcher<TypeParam> s;
+
+    for (int q = -1; q <= 21; ++q)
+    {
+        auto [lo, hi] = s.equal_range(fl.begin(), fl.end(), q);
+        auto [elo, ehi] = std::equal_range(fl.begin(), fl.end(), q);
+        ASSERT_EQ(std::distance(fl.begin(), lo), std::distance(fl.begin(), elo));
+        ASSERT_EQ(std::distance(fl.begin(), hi), std::distance(fl.begin(), ehi));
+    }
+}
+
+TEST(EqualRange, SharesProbesBetweenBounds)
+{
+    // Few distinct keys with long runs: the split happens after a couple of probes.
+    auto v = make_sorted_with_dups(1 << 16, 0, 7, 5u);
+
+    std::size_t calls = 0;
+    auto counting = [&calls](int a, int b) { ++calls; return a < b; };
+
+    boundcraft::searcher<boundcraft::policy::standard_binary> s;
+    std::size_t two_searches = 0;
+    std::size_t one_search = 0;
+
+    for (int q = 0; q <= 7; ++q)
+    {
+        calls = 0;
+        auto lo = s.lower_bound(v.begin(), v.end(), q, counting);
+        auto hi = s.upper_bound(v.begin(), v.end(), q, counting);
+        two_searches += calls;
+
+        calls = 0;
+        auto range = s.equal_range(v.begin(), v.end(), q, counting);
+        one_search += calls;
+
+        ASSERT_EQ(range.first, lo);
+        ASSERT_EQ(range.second, hi);
+    }
+
+    EXPECT_LT(one_search, two_searches);
+}
+
+} // namespace
@@ -0,0 +1,119 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <span>
+#include <vector>
+
+#include <boundcraft/boundcraft.hpp>
+
+#include "test-helpers.hpp"
+
+namespace {
+
+using boundcraft_tests::make_sorted_with_dups;
+
+template <class T>
+class EytzingerIndexTests : public ::testing::Test {};
+
+using EytzingerKeys = ::testing::Types<std::int32_t, std::int64_t, double>;
+TYPED_TEST_SUITE(EytzingerIndexTests, EytzingerKeys);
+
+TYPED_TEST(EytzingerIndexTests, EmptyIndex)
+{
+    boundcraft::eytzinger_index<TypeParam> idx(std::span<const TypeParam>{});
+    EXPECT_TRUE(idx.empty());
+    EXPECT_EQ(idx.lower_bound(TypeParam(1)), 0u);
+    EXPECT_EQ(idx.upper_bound(TypeParam(1)), 0u);
+}
+
+TYPED_TEST(EytzingerIndexTests, MatchesStdAcrossTreeShapes)
+{
+    using T = TypeParam;
+
+    // Complete, one-short and one-over sizes exercise every shape of the last level.
+    for (std::size_t n : {1u, 2u, 3u, 7u, 8u, 15u, 16u, 17u, 100u, 1023u, 1024u, 1025u, 5000u})
+    {
+        auto v = make_sorted_with_dups<T>(n, -300, 300, static_cast<std::uint32_t>(n));
+        boundcraft::eytzinger_index<T> idx{std::span<const T>(v)};
+        ASSERT_EQ(idx.size(), n);
+
+        for (int q = -305; q <= 305; ++q)
+        {
+            const T key = static_cast<T>(q);
+            ASSERT_EQ(idx.lower_bound(key), static_cast<std::size_t>(std::lower_bound(v.begin(), v.end(), key) - v.begin()));
+            ASSERT_EQ(idx.upper_bound(key), static_cast<std::size_t>(std::upper_bound(v.begin(), v.end(), key) - v.begin()));
+        }
+    }
+}
+
+TEST(EytzingerIndex, SearcherPolicyMatchesStd)
+{
+    auto v = make_sorted_with_dups<int>(20000, 0, 5000, 5u);
+    boundcraft::eytzinger_index<int> idx{std::span<const int>(v)};
+
+    boundcraft::searcher<boundcraft::policy::eytzinger<>> s;
+    boundcraft::searcher<boundcraft::policy::eytzinger<0>> s_no_prefetch;
+
+    std::mt19937 rng(6u);
+    std::uniform_int_distribution<int> qdist(-10, 5010);
+    for (int i = 0; i < 5000; ++i)
+    {
+        const int q = qdist(rng);
+        const auto lb = static_cast<std::size_t>(std::lower_bound(v.begin(), v.end(), q) - v.begin());
+        const auto ub = static_cast<std::size_t>(std::upper_bound(v.begin(), v.end(), q) - v.begin());
+
+        ASSERT_EQ(s.lower_bound(idx, q), lb);
+        ASSERT_EQ(s.upper_bound(idx, q), ub);
+        ASSERT_EQ(s_no_prefetch.lower_bound(idx, q), lb);
+    }
+}
+
+TEST(EytzingerIndex, DescendingWithGreaterComparator)
+{
+    auto v = make_sorted_with_dups<int>(777, -100, 100, 8u);
+    std::reverse(v.begin(), v.end());
+    boundcraft::eytzinger_index<int> idx{std::span<const int>(v)};
+
+    boundcraft::searcher<boundcraft::policy::eytzinger<>> s;
+    for (int q = -105; q <= 105; ++q)
+    {
+        EXPECT_EQ(s.lower_bound(idx, q, std::greater<>{}),
+                  static_cast<std::size_t>(std::lower_bound(v.begin(), v.end(), q, std::greater<>{}) - v.begin()));
+        EXPECT_EQ(s.upper_bound(idx, q, std::greater<>{}),
+                  static_cast<std::size_t>(std::upper_bound(v.begin(), v.end(), q, std::greater<>{}) - v.begin()));
+    }
+}
+
+TEST(EytzingerIndex, LayoutIsBreadthFirst)
+{
+    std::vector<int> v{1, 2, 3, 4, 5, 6, 7};
+    boundcraft::eytzinger_index<int> idx{std::span<const int>(v)};
+
+    auto layout = idx.layout();
+    ASSERT_EQ(layout.size(), 8u);
+    EXPECT_EQ(std::vector<int>(layout.begin() + 1, layout.end()), (std::vector<int>{4, 2, 6, 1, 3, 5, 7}));
+}
+
+TEST(EytzingerIndex, SlotRankIsTheSortedPosition)
+{
+    // With keys 0..n-1 the key stored at a slot is its own sorted position.
+    for (std::size_t n = 1; n <= 300; ++n)
+    {
+        std::vector<std::size_t> v(n);
+        for (std::size_t i = 0; i < n; ++i) v[i] = i;
+        boundcraft::eytzinger_index<std::size_t> idx{std::span<const std::size_t>(v)};
+
+        const auto layout = idx.layout();
+        for (std::size_t k = 1; k <= n; ++k)
+        {
+            ASSERT_EQ(boundcraft::detail::eytzinger_rank(k, n), layout[k]) << "n=" << n << " k=" << k;
+        }
+        ASSERT_EQ(boundcraft::detail::eytzinger_rank(0, n), n);
+    }
+}
+
+} // namespace
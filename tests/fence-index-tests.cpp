@@ -0,0 +1,148 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+#include <boundcraft/boundcraft.hpp>
+
+#include "test-helpers.hpp"
+
+namespace {
+
+using boundcraft_tests::make_sorted_with_dups;
+using boundcraft_tests::expect_matches_std;
+
+// Probes a key, its neighbours in value, and the keys just either side of position pos.
+template <class Index, class T>
+void expect_matches_std_around(const Index& index, std::span<const T> keys, std::size_t pos)
+{
+    for (std::size_t p = pos == 0 ? 0 : pos - 1; p <= pos + 1 && p < keys.size(); ++p)
+    {
+        expect_matches_std(index, keys, keys[p]);
+        expect_matches_std(index, keys, static_cast<T>(keys[p] + 1));
+        if (keys[p] > T(0))
+        {
+            expect_matches_std(index, keys, static_cast<T>(keys[p] - 1));
+        }
+    }
+}
+
+template <class T>
+class FenceIndexTests : public ::testing::Test {};
+
+using FenceKeys = ::testing::Types<std::int16_t, std::int32_t, std::uint64_t, double>;
+TYPED_TEST_SUITE(FenceIndexTests, FenceKeys);
+
+TYPED_TEST(FenceIndexTests, QueriesAroundEveryPageBoundary)
+{
+    using T = TypeParam;
+    auto v = make_sorted_with_dups<T>(20000, 1, 3000, 7u);
+
+    for (std::size_t page : {sizeof(T), std::size_t{64}, std::size_t{4096}, std::size_t{2} << 20})
+    {
+        // Start one record in so the first page is a partial one.
+        const std::span<const T> keys(v.data() + 1, v.size() - 1);
+        boundcraft::fence_index<T> index(keys, page);
+
+        EXPECT_GE(index.page_count(), keys.size() * sizeof(T) / page);
+        EXPECT_LE(index.page_count(), keys.size() * sizeof(T) / page + 2);
+
+        // The first record of each page, where one page's search range hands over to the next.
+        for (std::size_t pos = 0; pos < keys.size(); ++pos)
+        {
+            if (reinterpret_cast<std::uintptr_t>(keys.data() + pos) % page < sizeof(T))
+            {
+                expect_matches_std_around(index, keys, pos);
+            }
+        }
+        expect_matches_std_around(index, keys, 0);
+        expect_matches_std_around(index, keys, keys.size() - 1);
+        expect_matches_std(index, keys, T(0));
+        expect_matches_std(index, keys, T(3001));
+    }
+}
+
+TYPED_TEST(FenceIndexTests, EachPageLiesWithinOneAlignedPage)
+{
+    using T = TypeParam;
+    auto v = make_sorted_with_dups<T>(20000, 1, 3000, 7u);
+
+    for (std::size_t page : {sizeof(T), std::size_t{64}, std::size_t{4096}})
+    {
+        // A span starting one record into a page, so record offsets and page addresses disagree.
+        const std::span<const T> keys(v.data() + 1, v.size() - 1);
+        boundcraft::fence_index<T> index(keys, page);
+        const auto block = [page](const T* p) { return reinterpret_cast<std::uintptr_t>(p) / page; };
+
+        std::size_t covered = 0;
+        for (std::size_t i = 0; i < index.page_count(); ++i)
+        {
+            const std::span<const T> records = index.page(i);
+            ASSERT_FALSE(records.empty());
+            ASSERT_EQ(records.data(), keys.data() + covered);
+            // The page starts on an address boundary (or at the span) and ends before the next.
+            if (i > 0)
+            {
+                ASSERT_EQ(reinterpret_cast<std::uintptr_t>(records.data()) % page, 0u) << "page " << i;
+            }
+            const auto last_byte = reinterpret_cast<const unsigned char*>(records.data() + records.size()) - 1;
+            ASSERT_EQ(block(records.data()), reinterpret_cast<std::uintptr_t>(last_byte) / page) << "page " << i;
+            covered += records.size();
+        }
+        EXPECT_EQ(covered, keys.size());
+    }
+}
+
+TEST(FenceIndex, EmptyIndex)
+{
+    boundcraft::fence_index<std::int32_t> index(std::span<const std::int32_t>{});
+    EXPECT_EQ(index.page_count(), 0u);
+    EXPECT_EQ(index.lower_bound(1), index.begin());
+    EXPECT_EQ(index.upper_bound(1), index.begin());
+}
+
+TEST(FenceIndex, RandomQueriesWithSmallPages)
+{
+    auto v = make_sorted_with_dups<std::int32_t>(1 << 16, 0, 1 << 20, 3u);
+    boundcraft::fence_index<std::int32_t, boundcraft::policy::standard_binary> index(std::span<const std::int32_t>(v), 256);
+
+    std::mt19937 rng(4u);
+    std::uniform_int_distribution<std::int32_t> qdist(-5, (1 << 20) + 5);
+    for (int i = 0; i < 20000; ++i)
+    {
+        expect_matches_std(index, std::span<const std::int32_t>(v), qdist(rng));
+    }
+    EXPECT_LE(index.memory_bytes(), v.size() * sizeof(std::int32_t) / 256 * (sizeof(std::int32_t) + sizeof(std::size_t)) + 64);
+}
+
+TEST(FenceIndex, LongDuplicateRunsSpanningPages)
+{
+    std::vector<std::int64_t> v(3000, 5);
+    v.insert(v.begin(), 100, 1);
+    v.insert(v.end(), 100, 9);
+    boundcraft::fence_index<std::int64_t> index(std::span<const std::int64_t>(v), 128);
+
+    for (std::int64_t q : {0, 1, 2, 5, 6, 9, 10})
+    {
+        expect_matches_std(index, std::span<const std::int64_t>(v), q);
+    }
+}
+
+TEST(FenceIndex, RejectsPagesSmallerThanARecord)
+{
+    std::vector<std::int64_t> v{1, 2, 3};
+    EXPECT_THROW(boundcraft::fence_index<std::int64_t>(std::span<const std::int64_t>(v), 4), std::invalid_argument);
+}
+
+TEST(FenceIndex, RejectsPagesThatAreNotAPowerOfTwo)
+{
+    std::vector<std::int64_t> v{1, 2, 3};
+    EXPECT_THROW(boundcraft::fence_index<std::int64_t>(std::span<const std::int64_t>(v), 3000), std::invalid_argument);
+}
+
+} // namespace
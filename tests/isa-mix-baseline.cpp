@@ -0,0 +1,59 @@
+// Built without the host's vector extensions (see tests/CMakeLists.txt), next to test files
+// built with -march=native. Both instantiate the same boundcraft templates; isa-mix-tests.cpp
+// checks that the two copies are distinct symbols and that each gives the right answers.
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <typeinfo>
+
+#include <boundcraft/boundcraft.hpp>
+
+#include "isa-mix.hpp"
+
+namespace isa_mix {
+
+using searcher_t = boundcraft::searcher<boundcraft::policy::hybrid<16>>;
+
+bool baseline_simd_enabled()
+{
+    return boundcraft::detail::simd::enabled;
+}
+
+std::string baseline_searcher_name()
+{
+    return typeid(searcher_t).name();
+}
+
+std::size_t baseline_lower_bound(std::span<const int> keys, int value)
+{
+    return static_cast<std::size_t>(searcher_t{}.lower_bound(keys.data(), keys.data() + keys.size(), value) - keys.data());
+}
+
+std::size_t baseline_upper_bound(std::span<const int> keys, int value)
+{
+    return static_cast<std::size_t>(searcher_t{}.upper_bound(keys.data(), keys.data() + keys.size(), value) - keys.data());
+}
+
+std::string baseline_compressed_name()
+{
+    return typeid(boundcraft::compressed_array<std::uint32_t>).name();
+}
+
+void baseline_unpack(const std::uint32_t* words, unsigned bits, std::uint32_t* out)
+{
+    boundcraft::detail::bitpack::unpack(words, bits, out);
+}
+
+std::string baseline_elias_fano_name()
+{
+    return typeid(boundcraft::elias_fano<std::uint64_t>).name();
+}
+
+unsigned baseline_select_in_word(std::uint64_t w, unsigned k)
+{
+    return boundcraft::detail::bits::select_in_word(w, k);
+}
+
+} // namespace isa_mix
@@ -0,0 +1,98 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <span>
+#include <string>
+#include <typeinfo>
+#include <vector>
+
+#include <boundcraft/boundcraft.hpp>
+
+#include "isa-mix.hpp"
+#include "test-helpers.hpp"
+
+namespace {
+
+using boundcraft_tests::make_sorted_with_dups;
+using searcher_t = boundcraft::searcher<boundcraft::policy::hybrid<16>>;
+
+TEST(IsaMix, UnitsBuiltForDifferentIsasGetDistinctSymbols)
+{
+    if (boundcraft::detail::simd::enabled == isa_mix::baseline_simd_enabled())
+    {
+        GTEST_SKIP() << "both units were built for the same vector ISA";
+    }
+    EXPECT_NE(std::string(typeid(searcher_t).name()), isa_mix::baseline_searcher_name());
+    EXPECT_NE(isa_mix::baseline_searcher_name().find("scalar"), std::string::npos);
+    EXPECT_NE(std::string(typeid(boundcraft::compressed_array<std::uint32_t>).name()), isa_mix::baseline_compressed_name());
+}
+
+TEST(IsaMix, Bmi2UnitsGetDistinctSymbols)
+{
+#if defined(__BMI2__)
+    EXPECT_NE(std::string(typeid(boundcraft::elias_fano<std::uint64_t>).name()), isa_mix::baseline_elias_fano_name());
+    EXPECT_EQ(isa_mix::baseline_elias_fano_name().find("bmi2"), std::string::npos);
+#else
+    GTEST_SKIP() << "this unit is not built for BMI2";
+#endif
+}
+
+TEST(IsaMix, BothUnitsSelectTheSameBits)
+{
+    std::mt19937_64 rng(43u);
+    for (int i = 0; i < 2000; ++i)
+    {
+        const std::uint64_t w = rng() | 1u;
+        const auto ones = static_cast<unsigned>(std::popcount(w));
+        for (unsigned k = 0; k < ones; ++k)
+        {
+            const unsigned expect = boundcraft::detail::bits::select_in_word(w, k);
+            ASSERT_EQ(isa_mix::baseline_select_in_word(w, k), expect) << "w=" << w << " k=" << k;
+            ASSERT_EQ(std::popcount(w & ((std::uint64_t{2} << expect) - 1)), static_cast<int>(k + 1)) << "w=" << w << " k=" << k;
+        }
+    }
+}
+
+TEST(IsaMix, BothUnitsMatchStd)
+{
+    // The same instantiation is called from both units; with a shared symbol one of them would
+    // run the other's code.
+    const auto v = make_sorted_with_dups(5000, 0, 800, 31u);
+    const std::span<const int> keys(v);
+    for (int q = -2; q <= 802; ++q)
+    {
+        const auto lo = static_cast<std::size_t>(std::lower_bound(v.begin(), v.end(), q) - v.begin());
+        const auto hi = static_cast<std::size_t>(std::upper_bound(v.begin(), v.end(), q) - v.begin());
+        ASSERT_EQ(isa_mix::baseline_lower_bound(keys, q), lo) << "q=" << q;
+        ASSERT_EQ(isa_mix::baseline_upper_bound(keys, q), hi) << "q=" << q;
+        ASSERT_EQ(static_cast<std::size_t>(searcher_t{}.lower_bound(keys.data(), keys.data() + keys.size(), q) - keys.data()), lo) << "q=" << q;
+        ASSERT_EQ(static_cast<std::size_t>(searcher_t{}.upper_bound(keys.data(), keys.data() + keys.size(), q) - keys.data()), hi) << "q=" << q;
+    }
+}
+
+TEST(IsaMix, BothUnitsUnpackTheSameBlocks)
+{
+    namespace bitpack = boundcraft::detail::bitpack;
+    std::mt19937 rng(41u);
+    for (unsigned bits = 0; bits <= 32; ++bits)
+    {
+        const std::uint32_t mask = bits == 32 ? ~std::uint32_t{0} : (std::uint32_t{1} << bits) - 1;
+        std::vector<std::uint32_t> values(bitpack::block_values);
+        for (auto& x : values) x = static_cast<std::uint32_t>(rng()) & mask;
+
+        std::vector<std::uint32_t> words(bitpack::packed_words(bits) + 1, 0);
+        bitpack::pack(values.data(), bits, words.data());
+
+        std::vector<std::uint32_t> native(bitpack::block_values), baseline(bitpack::block_values);
+        bitpack::unpack(words.data(), bits, native.data());
+        isa_mix::baseline_unpack(words.data(), bits, baseline.data());
+        ASSERT_EQ(native, values) << "bits=" << bits;
+        ASSERT_EQ(baseline, values) << "bits=" << bits;
+    }
+}
+
+} // namespace
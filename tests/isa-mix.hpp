@@ -0,0 +1,21 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+
+// Entry points of tests/isa-mix-baseline.cpp, the translation unit built for the baseline ISA.
+
+namespace isa_mix {
+
+bool baseline_simd_enabled();
+std::string baseline_searcher_name();
+std::size_t baseline_lower_bound(std::span<const int> keys, int value);
+std::size_t baseline_upper_bound(std::span<const int> keys, int value);
+std::string baseline_compressed_name();
+void baseline_unpack(const std::uint32_t* words, unsigned bits, std::uint32_t* out);
+std::string baseline_elias_fano_name();
+unsigned baseline_select_in_word(std::uint64_t w, unsigned k);
+
+} // namespace isa_mix
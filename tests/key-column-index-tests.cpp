@@ -0,0 +1,126 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <span>
+#include <vector>
+
+#include <boundcraft/boundcraft.hpp>
+
+namespace {
+
+// One cache line per record, key first as in the typical row layout.
+struct record
+{
+    std::int64_t key;
+    std::uint32_t id;
+    char payload[52];
+};
+static_assert(sizeof(record) == 64);
+
+std::vector<record> make_sorted_records(std::size_t n, int minv, int maxv, std::uint32_t seed)
+{
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> dist(minv, maxv);
+    std::vector<record> v(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        v[i].key = dist(rng);
+        v[i].id = static_cast<std::uint32_t>(i);
+    }
+    std::sort(v.begin(), v.end(), [](const record& a, const record& b) { return a.key < b.key; });
+    return v;
+}
+
+template <class Index>
+void expect_matches_std(const Index& index, const std::vector<record>& v, std::int64_t q)
+{
+    auto lo = std::lower_bound(v.begin(), v.end(), q, [](const record& r, std::int64_t k) { return r.key < k; });
+    auto hi = std::upper_bound(v.begin(), v.end(), q, [](std::int64_t k, const record& r) { return k < r.key; });
+    ASSERT_EQ(index.lower_bound(q) - index.begin(), lo - v.begin()) << "q=" << q;
+    ASSERT_EQ(index.upper_bound(q) - index.begin(), hi - v.begin()) << "q=" << q;
+}
+
+template <class Index>
+void expect_probes_match_std(const Index& index, const std::vector<record>& v)
+{
+    ASSERT_EQ(index.size(), v.size());
+    for (const auto& r : v)
+    {
+        expect_matches_std(index, v, r.key - 1);
+        expect_matches_std(index, v, r.key);
+        expect_matches_std(index, v, r.key + 1);
+    }
+    expect_matches_std(index, v, -1000000);
+    expect_matches_std(index, v, 1000000);
+}
+
+template <class Policy>
+class KeyColumnIndexTests : public ::testing::Test {};
+
+using KeyColumnPolicies = ::testing::Types<boundcraft::policy::standard_binary, boundcraft::policy::branchless,
+                                           boundcraft::policy::hybrid<16>, boundcraft::policy::interpolation<>>;
+TYPED_TEST_SUITE(KeyColumnIndexTests, KeyColumnPolicies);
+
+TYPED_TEST(KeyColumnIndexTests, EmptyIndex)
+{
+    boundcraft::key_column_index<record, std::int64_t record::*, TypeParam> index(std::span<const record>{}, &record::key);
+    EXPECT_TRUE(index.empty());
+    EXPECT_EQ(index.lower_bound(std::int64_t{1}), index.begin());
+    EXPECT_EQ(index.upper_bound(std::int64_t{1}), index.begin());
+}
+
+TYPED_TEST(KeyColumnIndexTests, MemberPointerMatchesStd)
+{
+    for (std::size_t n : {1u, 2u, 17u, 100u, 5000u})
+    {
+        const auto v = make_sorted_records(n, -500, 500, static_cast<std::uint32_t>(n));
+        boundcraft::key_column_index<record, std::int64_t record::*, TypeParam> index(std::span<const record>(v), &record::key);
+        EXPECT_EQ(index.memory_bytes(), n * sizeof(std::int64_t));
+        expect_probes_match_std(index, v);
+    }
+}
+
+TYPED_TEST(KeyColumnIndexTests, RebindAfterAppendsExtractsOnlyTheTail)
+{
+    auto v = make_sorted_records(300, 0, 1000, 3u);
+    auto index = boundcraft::make_key_column_index<TypeParam>(std::span<const record>(v), [](const record& r) { return r.key; });
+
+    for (int round = 0; round < 5; ++round)
+    {
+        // Appending may reallocate; rebind picks up the new storage and the new tail.
+        for (int i = 0; i < 250; ++i)
+        {
+            record r{};
+            r.key = v.back().key + (i % 3);
+            v.push_back(r);
+        }
+        index.rebind(std::span<const record>(v));
+        ASSERT_EQ(index.keys().size(), v.size());
+        expect_probes_match_std(index, v);
+    }
+
+    v.resize(100);
+    index.rebind(std::span<const record>(v));
+    expect_probes_match_std(index, v);
+}
+
+TEST(KeyColumnIndex, DescendingKeysWithGreater)
+{
+    auto v = make_sorted_records(2000, -100, 100, 9u);
+    std::reverse(v.begin(), v.end());
+    boundcraft::key_column_index<record, std::int64_t record::*> index(std::span<const record>(v), &record::key);
+
+    for (std::int64_t q = -102; q <= 102; ++q)
+    {
+        auto lo = std::lower_bound(v.begin(), v.end(), q, [](const record& r, std::int64_t k) { return r.key > k; });
+        auto hi = std::upper_bound(v.begin(), v.end(), q, [](std::int64_t k, const record& r) { return k > r.key; });
+        ASSERT_EQ(index.lower_bound(q, std::greater<>{}) - index.begin(), lo - v.begin()) << "q=" << q;
+        ASSERT_EQ(index.upper_bound(q, std::greater<>{}) - index.begin(), hi - v.begin()) << "q=" << q;
+    }
+}
+
+} // namespace
@@ -2,8 +2,10 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <iterator>
+#include <limits>
 #include <random>
 #include <span>
 #include <type_traits>
@@ -12,6 +14,7 @@
 
 #include <boundcraft/boundcraft.hpp>
 
+#include "test-helpers.hpp"
 
 // ------------------------------------------------------------
 // Helpers
@@ -19,6 +22,8 @@
 
 namespace {
 
+using boundcraft_tests::make_sorted_with_dups;
+
 template <class It>
 std::size_t idx_of(It first, It it)
 {
@@ -65,17 +70,6 @@ void check_lb_span(std::vector<T>& v, const V& value, Comp comp)
     ASSERT_EQ(static_cast<std::size_t>(got - v.data()), idx_of(v.begin(), exp_it));
 }
 
-template <class T>
-std::vector<T> make_sorted_with_dups(std::size_t n, int minv, int maxv, std::mt19937& rng)
-{
-    std::uniform_int_distribution<int> dist(minv, maxv);
-    std::vector<T> v;
-    v.reserve(n);
-    for (std::size_t i = 0; i < n; ++i) v.push_back(static_cast<T>(dist(rng)));
-    std::sort(v.begin(), v.end());
-    return v;
-}
-
 template <class T>
 std::vector<T> make_sorted_desc_with_dups(std::size_t n, int minv, int maxv, std::mt19937& rng)
 {
@@ -94,12 +88,23 @@ namespace policies {
 
 // Search policies
 using stdbin = boundcraft::policy::standard_binary;
+using brless = boundcraft::policy::branchless;
+using pf1    = boundcraft::policy::prefetch_binary<1>;
+using pf2    = boundcraft::policy::prefetch_binary<2>;
 
 // Hybrid search policies
 using hyb1  = boundcraft::policy::hybrid<1>;
 using hyb4  = boundcraft::policy::hybrid<4>;
 using hyb16 = boundcraft::policy::hybrid<16>;
 using hyb64 = boundcraft::policy::hybrid<64>;
+using hyb_auto = boundcraft::policy::hybrid_auto;
+
+// Interpolation search policies
+using interp      = boundcraft::policy::interpolation<>;
+using interp_tiny = boundcraft::policy::interpolation<2, 1>;
+
+// Runtime-calibrated kernel choice
+using adaptive = boundcraft::policy::adaptive;
 
 // Gallop start strategies
 namespace gallop = boundcraft::policy::gallop;
@@ -121,6 +126,11 @@ using g_stdbin_middle  = galloping<stdbin, g_middle>;
 using g_stdbin_last3   = galloping<stdbin, g_last3>;
 using g_hyb16_middle   = galloping<hyb16, g_middle>;
 using g_hyb64_front    = galloping<hyb64, g_front>;
+using g_hyb_auto_back  = galloping<hyb_auto, g_back>;
+using g_pf2_middle     = galloping<pf2, g_middle>;
+using g_brless_middle  = galloping<brless, g_middle>;
+using g_brless_back    = galloping<brless, g_back>;
+using g_interp_middle  = galloping<interp, g_middle>;
 
 } // namespace policies
 
@@ -132,11 +142,15 @@ template <class Policy>
 class LowerBoundAscendingDeterministic : public ::testing::Test {};
 
 using AscDetPolicies = ::testing::Types<
-    policies::stdbin,
-    policies::hyb1, policies::hyb4, policies::hyb16, policies::hyb64,
+    policies::stdbin, policies::brless, policies::pf1, policies::pf2,
+    policies::hyb1, policies::hyb4, policies::hyb16, policies::hyb64, policies::hyb_auto,
+    policies::interp, policies::interp_tiny,
+    policies::adaptive,
     // Galloping policies are RA-only -> tested here with std::vector
     policies::g_stdbin_front, policies::g_stdbin_back, policies::g_stdbin_middle, policies::g_stdbin_last3,
-    policies::g_hyb16_middle, policies::g_hyb64_front
+    policies::g_hyb16_middle, policies::g_hyb64_front, policies::g_hyb_auto_back, policies::g_pf2_middle,
+    policies::g_brless_middle, policies::g_brless_back,
+    policies::g_interp_middle
 >;
 TYPED_TEST_SUITE(LowerBoundAscendingDeterministic, AscDetPolicies);
 
@@ -212,7 +226,12 @@ class LowerBoundDescendingDeterministic : public ::testing::Test {};
 
 using DescDetPolicies = ::testing::Types<
     policies::stdbin,
+    policies::brless,
+    policies::pf2,
     policies::hyb16,
+    policies::hyb_auto,
+    policies::interp,
+    policies::adaptive,
     policies::g_stdbin_middle,
     policies::g_hyb16_middle
 >;
@@ -243,7 +262,11 @@ class LowerBoundForwardIteratorCoverage : public ::testing::Test {};
 
 using ForwardPolicies = ::testing::Types<
     policies::stdbin,
-    policies::hyb16
+    policies::pf1,
+    policies::hyb16,
+    policies::hyb_auto,
+    policies::interp,
+    policies::adaptive
 >;
 TYPED_TEST_SUITE(LowerBoundForwardIteratorCoverage, ForwardPolicies);
 
@@ -260,6 +283,137 @@ TYPED_TEST(LowerBoundForwardIteratorCoverage, ForwardListMatchesStdLowerBound)
     }
 }
 
+// ------------------------------------------------------------
+// Arithmetic key coverage - the hybrid window is scanned with SIMD
+// kernels for these types when the build targets SSE4.2/AVX2.
+// ------------------------------------------------------------
+
+template <class T>
+class LowerBoundArithmeticKeys : public ::testing::Test {};
+
+using ArithmeticKeys = ::testing::Types<
+    std::int32_t, std::uint32_t, std::int64_t, std::uint64_t, float, double
+>;
+TYPED_TEST_SUITE(LowerBoundArithmeticKeys, ArithmeticKeys);
+
+TYPED_TEST(LowerBoundArithmeticKeys, HybridWindowMatchesStdLowerBound)
+{
+    using T = TypeParam;
+    std::mt19937 rng(2024u);
+
+    for (std::size_t n : {0u, 1u, 3u, 7u, 8u, 9u, 31u, 63u, 64u, 65u, 300u})
+    {
+        auto asc = make_sorted_with_dups<T>(n, 0, 100, rng);
+        auto desc = make_sorted_desc_with_dups<T>(n, 0, 100, rng);
+
+        for (int q = -1; q <= 101; ++q)
+        {
+            const T key = static_cast<T>(q);
+            check_lb_ptr<policies::hyb64>(asc, key, std::less<>{});
+            check_lb_span<policies::hyb16>(asc, key, std::less<>{});
+            check_lb_ptr<policies::hyb_auto>(asc, key, std::less<>{});
+            check_lb_ptr<policies::hyb_auto>(desc, key, std::greater<>{});
+            check_lb_iter<policies::g_hyb64_front>(asc, key, std::less<>{});
+            check_lb_ptr<policies::hyb64>(desc, key, std::greater<>{});
+        }
+    }
+}
+
+TYPED_TEST(LowerBoundArithmeticKeys, HybridWindowHandlesExtremeValues)
+{
+    using T = TypeParam;
+    using lim = std::numeric_limits<T>;
+
+    std::vector<T> v{lim::lowest(), lim::lowest(), T(0), T(1), T(1), T(2),
+                     T(lim::max() / 2), T(lim::max() / 2 + 1), lim::max(), lim::max()};
+
+    for (T q : v)
+    {
+        check_lb_ptr<policies::hyb64>(v, q, std::less<>{});
+    }
+    check_lb_ptr<policies::hyb64>(v, T(3), std::less<>{});
+}
+
+TYPED_TEST(LowerBoundArithmeticKeys, InterpolationSurvivesSkewedKeys)
+{
+    using T = TypeParam;
+
+    // Geometric growth defeats the linear estimate; the probe cap and the
+    // binary-probe guard must still land on the right answer.
+    std::vector<T> v;
+    for (std::uint64_t x = 1; v.size() < 40 && x <= static_cast<std::uint64_t>(std::numeric_limits<T>::max()) / 3; x *= 3)
+    {
+        v.push_back(static_cast<T>(x));
+        v.push_back(static_cast<T>(x));
+    }
+    std::vector<T> desc(v.rbegin(), v.rend());
+
+    for (std::size_t i = 0; i < v.size(); ++i)
+    {
+        for (T q : {v[i], static_cast<T>(v[i] - 1), static_cast<T>(v[i] + 1)})
+        {
+            check_lb_ptr<policies::interp>(v, q, std::less<>{});
+            check_lb_ptr<policies::interp_tiny>(v, q, std::less<>{});
+            check_lb_ptr<policies::interp_tiny>(desc, q, std::greater<>{});
+        }
+    }
+    check_lb_ptr<policies::interp_tiny>(v, std::numeric_limits<T>::max(), std::less<>{});
+    check_lb_ptr<policies::interp_tiny>(v, std::numeric_limits<T>::lowest(), std::less<>{});
+}
+
+// Both bounds of an interpolation search against std, for keys whose end values do not give a
+// usable double fraction.
+template <class T>
+void check_interp_bounds(const std::vector<T>& v, T q)
+{
+    boundcraft::searcher<policies::interp_tiny> s;
+    ASSERT_EQ(s.lower_bound(v.data(), v.data() + v.size(), q) - v.data(),
+              std::lower_bound(v.begin(), v.end(), q) - v.begin()) << "q=" << q;
+    ASSERT_EQ(s.upper_bound(v.data(), v.data() + v.size(), q) - v.data(),
+              std::upper_bound(v.begin(), v.end(), q) - v.begin()) << "q=" << q;
+}
+
+TEST(InterpolationEstimate, Int64KeysBeyondDoublePrecision)
+{
+    // Nanosecond timestamps: neighbours differ by 1, far above 2^53, so the ends of every
+    // range round to the same double.
+    const std::int64_t base = 1'700'000'000'000'000'000;
+    std::vector<std::int64_t> v;
+    for (std::int64_t i = 0; i < 200; ++i)
+    {
+        v.push_back(base + i / 2);
+    }
+
+    for (std::int64_t q = base - 2; q <= base + 102; ++q)
+    {
+        check_interp_bounds(v, q);
+    }
+}
+
+TEST(InterpolationEstimate, FloatRangesWithInfiniteEnds)
+{
+    constexpr float inf = std::numeric_limits<float>::infinity();
+    std::vector<float> v;
+    v.push_back(-inf);
+    for (int i = 0; i < 100; ++i)
+    {
+        v.push_back(static_cast<float>(i));
+    }
+    v.push_back(inf);
+    v.push_back(inf);
+
+    for (float q : {-inf, -1.0f, 0.0f, 0.5f, 42.0f, 99.0f, 150.0f, inf})
+    {
+        check_interp_bounds(v, q);
+    }
+
+    const std::vector<float> tail(v.begin() + 1, v.end());
+    for (float q : {-1.0f, 7.0f, 99.5f, inf})
+    {
+        check_interp_bounds(tail, q);
+    }
+}
+
 // ------------------------------------------------------------
 // Randomized property tests
 // ------------------------------------------------------------
@@ -269,13 +423,22 @@ class LowerBoundRandomized : public ::testing::Test {};
 
 using RandPolicies = ::testing::Types<
     policies::stdbin,
+    policies::brless,
+    policies::pf1,
+    policies::pf2,
     policies::hyb4,
     policies::hyb16,
+    policies::hyb_auto,
+    policies::interp,
+    policies::interp_tiny,
+    policies::adaptive,
     // Galloping policies are RA-only -> these tests use std::vector
     policies::g_stdbin_front,
     policies::g_stdbin_middle,
     policies::g_stdbin_last3,
-    policies::g_hyb16_middle
+    policies::g_hyb16_middle,
+    policies::g_brless_middle,
+    policies::g_interp_middle
 >;
 TYPED_TEST_SUITE(LowerBoundRandomized, RandPolicies);
 
@@ -337,3 +500,31 @@ TEST(GallopStartPolicy, StartLastSearchedBehavesCorrectly)
 
     ASSERT_EQ(idx_of(v.begin(), got), idx_of(v.begin(), exp));
 }
+
+// ------------------------------------------------------------
+// hybrid_auto threshold
+// ------------------------------------------------------------
+
+TEST(HybridAutoThreshold, CoversWholeCacheLinesOfElements)
+{
+    namespace traits = boundcraft::policy::traits;
+    using policies::hyb_auto;
+    constexpr std::size_t line = boundcraft::detail::target_cache_line_bytes;
+
+    struct wide
+    {
+        char bytes[4 * boundcraft::detail::target_cache_line_bytes];
+    };
+
+    static_assert(traits::hybrid_threshold_v<policies::hyb16, double> == 16);
+    static_assert(traits::hybrid_threshold_v<hyb_auto, const std::int32_t> == traits::hybrid_threshold_v<hyb_auto, std::int32_t>);
+    static_assert(traits::hybrid_threshold_v<hyb_auto, wide> == 1);
+
+    // Types the SIMD scan does not handle get one line; SIMD keys get two.
+    EXPECT_EQ((traits::hybrid_threshold_v<hyb_auto, std::int8_t>), line);
+    EXPECT_EQ((traits::hybrid_threshold_v<hyb_auto, std::int16_t>), line / 2);
+
+    constexpr std::size_t lines = boundcraft::detail::simd::enabled ? 2 : 1;
+    EXPECT_EQ((traits::hybrid_threshold_v<hyb_auto, std::int32_t>), lines * line / 4);
+    EXPECT_EQ((traits::hybrid_threshold_v<hyb_auto, double>), lines * line / 8);
+}
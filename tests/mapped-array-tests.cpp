@@ -0,0 +1,121 @@
+#include <gtest/gtest.h>
+
+#include <boundcraft/boundcraft.hpp>
+
+#include "test-helpers.hpp"
+
+#if defined(BOUNDCRAFT_HAS_MAPPED_ARRAY)
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <string>
+#include <system_error>
+#include <vector>
+
+namespace {
+
+using boundcraft_tests::make_sorted_with_dups;
+
+// Temporary file removed when the test ends.
+class temp_file
+{
+public:
+    explicit temp_file(const std::string& name)
+        : path_(std::filesystem::temp_directory_path() / ("boundcraft-" + name + "-" + std::to_string(::getpid())))
+    {
+    }
+    ~temp_file() { std::filesystem::remove(path_); }
+
+    template <class T>
+    void write(const std::vector<T>& v) const
+    {
+        std::ofstream f(path_, std::ios::binary | std::ios::trunc);
+        f.write(reinterpret_cast<const char*>(v.data()), static_cast<std::streamsize>(v.size() * sizeof(T)));
+    }
+
+    const std::filesystem::path& path() const { return path_; }
+
+private:
+    std::filesystem::path path_;
+};
+
+template <class Policy>
+class MappedArraySearch : public ::testing::Test {};
+
+using MappedPolicies = ::testing::Types<
+    boundcraft::policy::standard_binary,
+    boundcraft::policy::hybrid<64>,
+    boundcraft::policy::galloping<boundcraft::policy::branchless, boundcraft::policy::gallop::start_front>
+>;
+TYPED_TEST_SUITE(MappedArraySearch, MappedPolicies);
+
+TYPED_TEST(MappedArraySearch, PoliciesRunDirectlyOnTheMapping)
+{
+    const auto v = make_sorted_with_dups<std::uint64_t>(100000, std::uint64_t{0}, std::uint64_t{400000}, 1u);
+    temp_file file("search");
+    file.write(v);
+
+    boundcraft::mapped_array<std::uint64_t> mapped(file.path());
+    ASSERT_EQ(mapped.size(), v.size());
+    ASSERT_TRUE(std::equal(mapped.begin(), mapped.end(), v.begin()));
+    mapped.warm_up(12);
+
+    boundcraft::searcher<TypeParam> s;
+    std::mt19937_64 rng(2u);
+    std::uniform_int_distribution<std::uint64_t> qdist(0, v.size() * 4 + 2);
+    for (int i = 0; i < 5000; ++i)
+    {
+        const std::uint64_t q = qdist(rng);
+        ASSERT_EQ(s.lower_bound(mapped.begin(), mapped.end(), q) - mapped.begin(), std::lower_bound(v.begin(), v.end(), q) - v.begin());
+        ASSERT_EQ(s.upper_bound(mapped.span(), q) - mapped.begin(), std::upper_bound(v.begin(), v.end(), q) - v.begin());
+    }
+}
+
+TEST(MappedArray, EmptyFileMapsToEmptyRange)
+{
+    temp_file file("empty");
+    file.write(std::vector<std::uint32_t>{});
+
+    boundcraft::mapped_array<std::uint32_t> mapped(file.path());
+    EXPECT_TRUE(mapped.empty());
+    EXPECT_EQ(mapped.begin(), mapped.end());
+    mapped.warm_up(4);
+    mapped.advise(boundcraft::access_pattern::sequential);
+}
+
+TEST(MappedArray, MissingFileThrows)
+{
+    EXPECT_THROW(boundcraft::mapped_array<int>("/nonexistent/boundcraft/keys.bin"), std::system_error);
+}
+
+TEST(MappedArray, PartialRecordThrows)
+{
+    temp_file file("partial");
+    file.write(std::vector<char>{1, 2, 3, 4, 5});
+    EXPECT_THROW(boundcraft::mapped_array<std::uint32_t>(file.path()), std::system_error);
+}
+
+TEST(MappedArray, MoveTransfersTheMapping)
+{
+    const std::vector<std::int32_t> v{1, 3, 5, 7};
+    temp_file file("move");
+    file.write(v);
+
+    boundcraft::mapped_array<std::int32_t> a(file.path(), boundcraft::access_pattern::sequential);
+    boundcraft::mapped_array<std::int32_t> b(std::move(a));
+    EXPECT_TRUE(a.empty());
+    ASSERT_EQ(b.size(), 4u);
+    EXPECT_EQ(b[2], 5);
+
+    a = std::move(b);
+    EXPECT_TRUE(b.empty());
+    EXPECT_EQ(a[3], 7);
+}
+
+} // namespace
+
+#endif
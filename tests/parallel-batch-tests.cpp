@@ -0,0 +1,177 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <boundcraft/boundcraft.hpp>
+
+#include "test-helpers.hpp"
+
+namespace {
+
+using boundcraft_tests::make_sorted_with_dups;
+
+std::vector<int> make_queries(std::size_t m, int minv, int maxv, std::uint32_t seed)
+{
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> dist(minv, maxv);
+    std::vector<int> q(m);
+    for (auto& x : q) x = dist(rng);
+    return q;
+}
+
+// Runs every task on the calling thread.
+struct inline_executor
+{
+    std::size_t tasks = 0;
+    void execute(std::function<void()> task) { ++tasks; task(); }
+};
+
+// Starts a detached thread per task; has no size(), so the search sizes itself by the hardware.
+struct thread_per_task_executor
+{
+    void execute(std::function<void()> task) { std::thread(std::move(task)).detach(); }
+};
+
+// Reports four workers, starts a thread for the first task and throws on the second.
+struct failing_executor
+{
+    std::size_t tasks = 0;
+    std::size_t size() const { return 4; }
+    void execute(std::function<void()> task)
+    {
+        if (tasks++ > 0) throw std::runtime_error("executor is full");
+        std::thread(std::move(task)).detach();
+    }
+};
+
+static_assert(boundcraft::executor<inline_executor>);
+static_assert(boundcraft::executor<thread_per_task_executor>);
+static_assert(boundcraft::executor<failing_executor>);
+
+template <class Policy>
+class ParallelBatchTests : public ::testing::Test {};
+
+using ParallelPolicies = ::testing::Types<
+    boundcraft::policy::standard_binary,
+    boundcraft::policy::branchless,
+    boundcraft::policy::hybrid<16>,
+    boundcraft::policy::galloping<boundcraft::policy::standard_binary, boundcraft::policy::gallop::start_middle>
+>;
+TYPED_TEST_SUITE(ParallelBatchTests, ParallelPolicies);
+
+TYPED_TEST(ParallelBatchTests, ThreadPoolMatchesStd)
+{
+    auto v = make_sorted_with_dups(50000, -100000, 100000, 1u);
+    auto q = make_queries(30001, -100100, 100100, 2u);
+    boundcraft::thread_pool pool(4);
+
+    std::vector<std::vector<int>::const_iterator> lo(q.size()), hi(q.size());
+    boundcraft::parallel_lower_bound_batch<TypeParam>(pool, v.cbegin(), v.cend(), std::span<const int>(q),
+                                                      std::span(lo), std::less<>{}, 1000);
+    boundcraft::parallel_upper_bound_batch<TypeParam>(pool, v.cbegin(), v.cend(), std::span<const int>(q),
+                                                      std::span(hi), std::less<>{}, 1000);
+
+    for (std::size_t i = 0; i < q.size(); ++i)
+    {
+        ASSERT_EQ(lo[i], std::lower_bound(v.cbegin(), v.cend(), q[i]));
+        ASSERT_EQ(hi[i], std::upper_bound(v.cbegin(), v.cend(), q[i]));
+    }
+}
+
+TEST(ParallelBatch, EmptyKeysSubmitNothing)
+{
+    std::vector<int> v{1, 2, 3};
+    std::vector<const int*> out;
+    inline_executor exec;
+
+    boundcraft::parallel_lower_bound_batch<boundcraft::policy::hybrid<16>>(
+        exec, std::as_const(v).data(), std::as_const(v).data() + v.size(), std::span<const int>{}, std::span(out));
+    EXPECT_EQ(exec.tasks, 0u);
+}
+
+TEST(ParallelBatch, UserExecutorsAndDescendingOrder)
+{
+    auto v = make_sorted_with_dups(4000, 0, 500, 3u);
+    std::reverse(v.begin(), v.end());
+    auto q = make_queries(9999, -5, 505, 4u);
+
+    std::vector<const int*> got(q.size());
+
+    inline_executor inline_exec;
+    boundcraft::parallel_lower_bound_batch<boundcraft::policy::standard_binary>(
+        inline_exec, std::as_const(v).data(), std::as_const(v).data() + v.size(), std::span<const int>(q), std::span(got), std::greater<>{}, 128);
+    for (std::size_t i = 0; i < q.size(); ++i)
+    {
+        ASSERT_EQ(got[i] - v.data(), std::lower_bound(v.begin(), v.end(), q[i], std::greater<>{}) - v.begin()) << i;
+    }
+
+    std::fill(got.begin(), got.end(), nullptr);
+    thread_per_task_executor thread_exec;
+    boundcraft::parallel_upper_bound_batch<boundcraft::policy::hybrid<16>>(
+        thread_exec, std::as_const(v).data(), std::as_const(v).data() + v.size(), std::span<const int>(q), std::span(got), std::greater<>{}, 64);
+    for (std::size_t i = 0; i < q.size(); ++i)
+    {
+        ASSERT_EQ(got[i] - v.data(), std::upper_bound(v.begin(), v.end(), q[i], std::greater<>{}) - v.begin()) << i;
+    }
+}
+
+TEST(ParallelBatch, SubmitFailureFinishesTheBatchBeforeRethrowing)
+{
+    auto v = make_sorted_with_dups(3000, 0, 400, 9u);
+    auto q = make_queries(20000, -5, 405, 10u);
+    std::vector<const int*> got(q.size());
+
+    failing_executor exec;
+    EXPECT_THROW((boundcraft::parallel_lower_bound_batch<boundcraft::policy::hybrid<16>>(
+                     exec, std::as_const(v).data(), std::as_const(v).data() + v.size(), std::span<const int>(q), std::span(got), std::less<>{}, 256)),
+                 std::runtime_error);
+    EXPECT_EQ(exec.tasks, 2u);
+
+    // Every chunk was searched, by the started helper or the caller, before the error escaped.
+    for (std::size_t i = 0; i < q.size(); ++i)
+    {
+        ASSERT_EQ(got[i] - v.data(), std::lower_bound(v.begin(), v.end(), q[i]) - v.begin()) << i;
+    }
+}
+
+TEST(ParallelBatch, CallsFromInsideABusyPoolComplete)
+{
+    // Both pool threads run an outer task that itself searches in parallel on the same pool, so
+    // the helper tasks it submits can only start once an outer task is done.
+    auto v = make_sorted_with_dups(1000, 0, 100, 5u);
+    auto q = make_queries(5000, 0, 100, 6u);
+    std::vector<const int*> got_a(q.size()), got_b(q.size());
+
+    boundcraft::thread_pool pool(2);
+    std::atomic<int> finished{0};
+    for (auto* got : {&got_a, &got_b})
+    {
+        pool.execute([&, got]
+                     {
+            boundcraft::parallel_lower_bound_batch<boundcraft::policy::standard_binary>(
+                pool, std::as_const(v).data(), std::as_const(v).data() + v.size(), std::span<const int>(q), std::span(*got), std::less<>{}, 64);
+            ++finished; });
+    }
+
+    while (finished < 2)
+    {
+        std::this_thread::yield();
+    }
+    for (std::size_t i = 0; i < q.size(); ++i)
+    {
+        ASSERT_EQ(got_a[i] - v.data(), std::lower_bound(v.begin(), v.end(), q[i]) - v.begin());
+        ASSERT_EQ(got_b[i], got_a[i]);
+    }
+}
+
+} // namespace
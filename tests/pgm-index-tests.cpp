@@ -0,0 +1,125 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <span>
+#include <vector>
+
+#include <boundcraft/boundcraft.hpp>
+
+#include "test-helpers.hpp"
+
+namespace {
+
+using boundcraft_tests::make_sorted_with_dups;
+using boundcraft_tests::expect_matches_std;
+
+template <class T>
+class PgmIndexTests : public ::testing::Test {};
+
+using PgmKeys = ::testing::Types<std::int32_t, std::uint32_t, std::int64_t, std::uint64_t, float, double>;
+TYPED_TEST_SUITE(PgmIndexTests, PgmKeys);
+
+TYPED_TEST(PgmIndexTests, EmptyIndex)
+{
+    boundcraft::pgm_index<TypeParam> index(std::span<const TypeParam>{});
+    EXPECT_TRUE(index.empty());
+    EXPECT_EQ(index.segment_count(), 0u);
+    EXPECT_EQ(index.lower_bound(TypeParam(3)), index.begin());
+    EXPECT_EQ(index.upper_bound(TypeParam(3)), index.begin());
+}
+
+TYPED_TEST(PgmIndexTests, MatchesStdWithDuplicates)
+{
+    using T = TypeParam;
+
+    for (std::size_t n : {1u, 2u, 17u, 200u, 5000u, 40000u})
+    {
+        auto v = make_sorted_with_dups<T>(n, 0, 3000, static_cast<std::uint32_t>(n));
+        boundcraft::pgm_index<T, 1> tight{std::span<const T>(v)};
+        boundcraft::pgm_index<T, 16> medium{std::span<const T>(v)};
+        boundcraft::pgm_index<T> loose{std::span<const T>(v)};
+
+        for (int q = -2; q <= 3002; ++q)
+        {
+            expect_matches_std(tight, v, static_cast<T>(q));
+            expect_matches_std(medium, v, static_cast<T>(q));
+            expect_matches_std(loose, v, static_cast<T>(q));
+        }
+    }
+}
+
+TYPED_TEST(PgmIndexTests, LongDuplicateRunsFallBackCorrectly)
+{
+    using T = TypeParam;
+
+    // Runs far longer than Epsilon between sparse distinct keys.
+    std::vector<T> v;
+    for (int k = 0; k < 20; ++k)
+    {
+        v.insert(v.end(), static_cast<std::size_t>(50 + 37 * k), static_cast<T>(k * 10));
+    }
+
+    boundcraft::pgm_index<T, 4> index{std::span<const T>(v)};
+    for (int q = -1; q <= 200; ++q)
+    {
+        expect_matches_std(index, v, static_cast<T>(q));
+    }
+}
+
+TYPED_TEST(PgmIndexTests, HandlesExtremeKeys)
+{
+    using T = TypeParam;
+    using lim = std::numeric_limits<T>;
+
+    std::vector<T> v{lim::lowest(), lim::lowest(), T(0), T(1), T(1), T(7)};
+    for (int i = 0; i < 300; ++i) v.push_back(T(9));
+    v.push_back(T(lim::max() / 2));
+    v.push_back(lim::max());
+
+    boundcraft::pgm_index<T, 2> index{std::span<const T>(v)};
+    for (T q : {lim::lowest(), T(0), T(1), T(8), T(9), T(10), T(lim::max() / 2), lim::max()})
+    {
+        expect_matches_std(index, v, q);
+    }
+}
+
+TEST(PgmIndex, LinearKeysNeedOneSegment)
+{
+    std::vector<std::int64_t> v(1 << 16);
+    for (std::size_t i = 0; i < v.size(); ++i) v[i] = static_cast<std::int64_t>(3 * i + 11);
+
+    boundcraft::pgm_index<std::int64_t, 8> index{std::span<const std::int64_t>(v)};
+    EXPECT_EQ(index.segment_count(), 1u);
+
+    for (std::int64_t q = 0; q < static_cast<std::int64_t>(3 * v.size() + 20); q += 7)
+    {
+        expect_matches_std(index, v, q);
+    }
+}
+
+TEST(PgmIndex, SkewedKeysStayCorrectAndCompact)
+{
+    std::vector<double> v(1 << 16);
+    for (std::size_t i = 0; i < v.size(); ++i) v[i] = std::pow(static_cast<double>(i), 2.5);
+
+    boundcraft::pgm_index<double, 32> index{std::span<const double>(v)};
+    EXPECT_LT(index.segment_count(), v.size() / 64);
+
+    std::mt19937 rng(5u);
+    std::uniform_real_distribution<double> qdist(-1.0, v.back() + 1.0);
+    for (int i = 0; i < 20000; ++i)
+    {
+        expect_matches_std(index, v, qdist(rng));
+    }
+    for (std::size_t i = 0; i < v.size(); i += 97)
+    {
+        expect_matches_std(index, v, v[i]);
+    }
+}
+
+} // namespace
@@ -0,0 +1,101 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <span>
+#include <vector>
+
+#include <boundcraft/boundcraft.hpp>
+
+#include "test-helpers.hpp"
+
+namespace {
+
+using boundcraft_tests::make_sorted_with_dups;
+using boundcraft_tests::expect_matches_std;
+
+template <class T>
+class RadixHintIndexTests : public ::testing::Test {};
+
+using RadixKeys = ::testing::Types<std::int16_t, std::int32_t, std::uint32_t, std::int64_t, std::uint64_t>;
+TYPED_TEST_SUITE(RadixHintIndexTests, RadixKeys);
+
+TYPED_TEST(RadixHintIndexTests, EmptyIndex)
+{
+    boundcraft::radix_hint_index<TypeParam> index(std::span<const TypeParam>{});
+    EXPECT_TRUE(index.empty());
+    EXPECT_EQ(index.lower_bound(TypeParam(3)), index.begin());
+    EXPECT_EQ(index.upper_bound(TypeParam(3)), index.begin());
+}
+
+TYPED_TEST(RadixHintIndexTests, MatchesStdWithDuplicates)
+{
+    using T = TypeParam;
+
+    for (std::size_t n : {1u, 2u, 17u, 300u, 5000u})
+    {
+        auto v = make_sorted_with_dups<T>(n, 0, 2000, static_cast<std::uint32_t>(n));
+        boundcraft::radix_hint_index<T> hybrid{std::span<const T>(v)};
+        boundcraft::radix_hint_index<T, 4, boundcraft::policy::standard_binary> coarse{std::span<const T>(v)};
+
+        for (int q = -2; q <= 2002; ++q)
+        {
+            expect_matches_std(hybrid, v, static_cast<T>(q));
+            expect_matches_std(coarse, v, static_cast<T>(q));
+        }
+    }
+}
+
+TYPED_TEST(RadixHintIndexTests, HandlesFullKeyRange)
+{
+    using T = TypeParam;
+    using lim = std::numeric_limits<T>;
+
+    std::vector<T> v{lim::lowest(), lim::lowest(), T(0), T(1), T(1), T(7), T(lim::max() / 2), lim::max(), lim::max()};
+    boundcraft::radix_hint_index<T, 8> index{std::span<const T>(v)};
+
+    for (T q : {lim::lowest(), T(lim::lowest() + 1), T(0), T(1), T(2), T(8), T(lim::max() / 2), T(lim::max() - 1), lim::max()})
+    {
+        expect_matches_std(index, v, q);
+    }
+}
+
+TEST(RadixHintIndex, ShiftAdaptsToKeyRange)
+{
+    // A narrow band of large keys: the buckets should cover the band, not the whole type.
+    std::vector<std::uint64_t> v;
+    for (std::uint64_t i = 0; i < 4096; ++i) v.push_back((std::uint64_t{1} << 50) + 3 * i);
+
+    boundcraft::radix_hint_index<std::uint64_t, 8> index{std::span<const std::uint64_t>(v)};
+    EXPECT_EQ(index.shift(), 6);
+    EXPECT_EQ(index.bucket_count(), 192u);
+
+    for (std::uint64_t q = v.front() - 2; q <= v.back() + 2; ++q)
+    {
+        expect_matches_std(index, v, q);
+    }
+}
+
+TEST(RadixHintIndex, SkewedKeysMatchStd)
+{
+    std::vector<std::int64_t> v;
+    for (std::int64_t i = 0; i < 20000; ++i) v.push_back(i * i * i);
+
+    boundcraft::radix_hint_index<std::int64_t, 12, boundcraft::policy::interpolation<>> index{std::span<const std::int64_t>(v)};
+
+    std::mt19937_64 rng(9u);
+    std::uniform_int_distribution<std::int64_t> qdist(-5, v.back() + 5);
+    for (int i = 0; i < 20000; ++i)
+    {
+        expect_matches_std(index, v, qdist(rng));
+    }
+    for (std::size_t i = 0; i < v.size(); i += 13)
+    {
+        expect_matches_std(index, v, v[i]);
+    }
+}
+
+} // namespace
@@ -0,0 +1,131 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <span>
+#include <thread>
+#include <vector>
+
+#include <boundcraft/boundcraft.hpp>
+
+#include "test-helpers.hpp"
+
+namespace {
+
+using boundcraft_tests::make_sorted_with_dups;
+using boundcraft_tests::expect_matches_std;
+
+template <class T>
+class ReplicatedIndexTyped : public ::testing::Test {};
+
+using KeyTypes = ::testing::Types<std::int32_t, std::uint64_t, double>;
+TYPED_TEST_SUITE(ReplicatedIndexTyped, KeyTypes);
+
+TYPED_TEST(ReplicatedIndexTyped, MatchesStdAcrossSizes)
+{
+    using T = TypeParam;
+    for (std::size_t n : {0u, 1u, 2u, 17u, 1000u, 40000u})
+    {
+        auto v = make_sorted_with_dups<T>(n, 0, static_cast<int>(n / 2 + 1), static_cast<std::uint32_t>(n) + 3u);
+        boundcraft::replicated_index<T> index{std::span<const T>(v)};
+        ASSERT_EQ(index.size(), n);
+
+        for (int q = -1; q <= static_cast<int>(n / 2 + 2); ++q)
+        {
+            expect_matches_std(index, v, static_cast<T>(q));
+        }
+    }
+}
+
+TEST(ReplicatedIndex, EveryReplicaHoldsTheWholeArray)
+{
+    auto v = make_sorted_with_dups<std::int64_t>(5000, -100000, 100000, 7u);
+    boundcraft::replicated_index<std::int64_t> index{std::span<const std::int64_t>(v)};
+
+    ASSERT_GE(index.replica_count(), 1u);
+    EXPECT_EQ(index.memory_bytes(), index.replica_count() * v.size() * sizeof(std::int64_t));
+    for (std::size_t r = 0; r < index.replica_count(); ++r)
+    {
+        const auto replica = index.replica(r);
+        ASSERT_EQ(replica.size(), v.size());
+        EXPECT_TRUE(std::equal(replica.begin(), replica.end(), v.begin()));
+    }
+
+    const auto local = index.local();
+    EXPECT_TRUE(std::equal(local.begin(), local.end(), v.begin(), v.end()));
+}
+
+TEST(ReplicatedIndex, HugePagesAndPolicyChoice)
+{
+    auto v = make_sorted_with_dups<std::uint32_t>(1u << 16, 0, 1 << 20, 11u);
+    boundcraft::replicated_index<std::uint32_t, boundcraft::policy::prefetch_binary<1>> index(
+        std::span<const std::uint32_t>(v), boundcraft::replica_options{.huge_pages = true});
+
+    std::mt19937 rng(5u);
+    std::uniform_int_distribution<std::uint32_t> dist(0, (1u << 20) + 1);
+    for (int i = 0; i < 2000; ++i)
+    {
+        expect_matches_std(index, v, dist(rng));
+    }
+}
+
+TEST(ReplicatedIndex, DescendingWithGreater)
+{
+    auto v = make_sorted_with_dups<int>(3000, -500, 500, 13u);
+    std::reverse(v.begin(), v.end());
+    boundcraft::replicated_index<int> index{std::span<const int>(v)};
+
+    for (int q = -501; q <= 501; ++q)
+    {
+        const auto lo = std::lower_bound(v.begin(), v.end(), q, std::greater<>{}) - v.begin();
+        const auto hi = std::upper_bound(v.begin(), v.end(), q, std::greater<>{}) - v.begin();
+        ASSERT_EQ(index.lower_bound(q, std::greater<>{}), static_cast<std::size_t>(lo)) << "q=" << q;
+        ASSERT_EQ(index.upper_bound(q, std::greater<>{}), static_cast<std::size_t>(hi)) << "q=" << q;
+    }
+}
+
+TEST(ReplicatedIndex, ConcurrentLookupsFromManyThreads)
+{
+    auto v = make_sorted_with_dups<std::int32_t>(20000, 0, 50000, 17u);
+    const boundcraft::replicated_index<std::int32_t> index{std::span<const std::int32_t>(v)};
+
+    std::vector<std::thread> threads;
+    std::vector<int> mismatches(4, 0);
+    for (std::size_t t = 0; t < mismatches.size(); ++t)
+    {
+        threads.emplace_back([&, t] {
+            for (std::int32_t q = static_cast<std::int32_t>(t); q <= 50001; q += 4)
+            {
+                const auto expect = std::lower_bound(v.begin(), v.end(), q) - v.begin();
+                mismatches[t] += index.lower_bound(q) != static_cast<std::size_t>(expect);
+            }
+        });
+    }
+    for (auto& th : threads)
+        th.join();
+
+    for (int m : mismatches)
+        EXPECT_EQ(m, 0);
+}
+
+TEST(ReplicatedIndex, MoveKeepsReplicas)
+{
+    auto v = make_sorted_with_dups<int>(1000, 0, 300, 19u);
+    boundcraft::replicated_index<int> a{std::span<const int>(v)};
+    boundcraft::replicated_index<int> b(std::move(a));
+    for (int q = -1; q <= 301; ++q)
+    {
+        expect_matches_std(b, v, q);
+    }
+
+    boundcraft::replicated_index<int> c;
+    EXPECT_TRUE(c.empty());
+    EXPECT_EQ(c.lower_bound(5), 0u);
+    c = std::move(b);
+    expect_matches_std(c, v, 150);
+}
+
+}
@@ -0,0 +1,85 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <random>
+#include <span>
+#include <vector>
+
+#include <boundcraft/boundcraft.hpp>
+
+#include "test-helpers.hpp"
+
+namespace {
+
+using boundcraft_tests::make_sorted_with_dups;
+using boundcraft_tests::expect_matches_std;
+
+template <class T>
+class STreeTests : public ::testing::Test {};
+
+using STreeKeys = ::testing::Types<std::int16_t, std::int32_t, std::uint32_t, std::int64_t, std::uint64_t, float, double>;
+TYPED_TEST_SUITE(STreeTests, STreeKeys);
+
+TYPED_TEST(STreeTests, EmptyTree)
+{
+    boundcraft::s_tree<TypeParam> tree(std::span<const TypeParam>{});
+    EXPECT_TRUE(tree.empty());
+    EXPECT_EQ(tree.lower_bound(TypeParam(3)), tree.end());
+    EXPECT_EQ(tree.upper_bound(TypeParam(3)), tree.end());
+}
+
+TYPED_TEST(STreeTests, MatchesStdAcrossLayerBoundaries)
+{
+    using T = TypeParam;
+    constexpr std::size_t B = boundcraft::s_tree<T>::node_keys;
+    constexpr std::size_t F = boundcraft::s_tree<T>::fanout;
+
+    for (std::size_t n : {std::size_t{1}, B - 1, B, B + 1, B * F - 1, B * F, B * F + 1, B * F * F + 3, std::size_t{20000}})
+    {
+        auto v = make_sorted_with_dups<T>(n, 0, 400, static_cast<std::uint32_t>(n));
+        boundcraft::s_tree<T> tree{std::span<const T>(v)};
+        ASSERT_EQ(tree.size(), n);
+        ASSERT_TRUE(std::equal(tree.begin(), tree.end(), v.begin(), v.end()));
+
+        for (int q = -2; q <= 402; ++q)
+        {
+            expect_matches_std(tree, v, static_cast<T>(q));
+        }
+    }
+}
+
+TYPED_TEST(STreeTests, HandlesExtremeKeys)
+{
+    using T = TypeParam;
+    using lim = std::numeric_limits<T>;
+
+    std::vector<T> v{lim::lowest(), lim::lowest(), T(0), T(1), T(1), T(7)};
+    for (int i = 0; i < 40; ++i) v.push_back(T(9));
+    v.push_back(lim::max());
+    v.push_back(lim::max());
+
+    boundcraft::s_tree<T> tree{std::span<const T>(v)};
+    for (T q : {lim::lowest(), T(0), T(1), T(8), T(9), T(10), lim::max()})
+    {
+        expect_matches_std(tree, v, q);
+    }
+}
+
+TEST(STree, LargeRandomInt32)
+{
+    auto v = make_sorted_with_dups<std::int32_t>(1 << 18, -1'000'000, 1'000'000, 77u);
+    boundcraft::s_tree<std::int32_t> tree{std::span<const std::int32_t>(v)};
+
+    std::mt19937 rng(78u);
+    std::uniform_int_distribution<std::int32_t> qdist(-1'000'100, 1'000'100);
+    for (int i = 0; i < 20000; ++i)
+    {
+        expect_matches_std(tree, v, qdist(rng));
+    }
+}
+
+} // namespace
@@ -0,0 +1,194 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <random>
+#include <utility>
+#include <span>
+#include <vector>
+
+#include <boundcraft/boundcraft.hpp>
+
+#include "test-helpers.hpp"
+
+namespace {
+
+using boundcraft_tests::make_sorted_with_dups;
+
+template <class Policy, class T, class Comp = std::less<>>
+void check_intersect(const std::vector<T>& a, const std::vector<T>& b, Comp comp = {})
+{
+    std::vector<T> expected;
+    std::set_intersection(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(expected), comp);
+
+    std::vector<T> out(std::min(a.size(), b.size()));
+    const std::size_t n = boundcraft::intersect<Policy>(std::span<const T>(a), std::span<const T>(b), std::span<T>(out), comp);
+    out.resize(n);
+    ASSERT_EQ(out, expected);
+
+    ASSERT_EQ(boundcraft::count_intersection<Policy>(std::span<const T>(b), std::span<const T>(a), comp), expected.size());
+}
+
+template <class T>
+class IntersectKeys : public ::testing::Test {};
+
+using IntersectKeyTypes = ::testing::Types<std::int32_t, std::uint32_t, std::int64_t, double>;
+TYPED_TEST_SUITE(IntersectKeys, IntersectKeyTypes);
+
+TYPED_TEST(IntersectKeys, EmptyInputs)
+{
+    using T = TypeParam;
+    check_intersect<boundcraft::policy::hybrid<16>, T>({}, {});
+    check_intersect<boundcraft::policy::hybrid<16>, T>({T(1), T(2)}, {});
+    check_intersect<boundcraft::policy::hybrid<16>, T>({}, {T(1), T(2)});
+}
+
+TYPED_TEST(IntersectKeys, SimilarSizesUseMerge)
+{
+    using T = TypeParam;
+    for (std::uint32_t seed = 0; seed < 10; ++seed)
+    {
+        auto a = make_sorted_with_dups<T>(500 + seed * 37, 0, 2000, seed);
+        auto b = make_sorted_with_dups<T>(700 - seed * 11, 0, 2000, seed + 100);
+        check_intersect<boundcraft::policy::hybrid<16>>(a, b);
+    }
+}
+
+TYPED_TEST(IntersectKeys, SkewedSizesUseGallop)
+{
+    using T = TypeParam;
+    for (std::uint32_t seed = 0; seed < 10; ++seed)
+    {
+        auto small = make_sorted_with_dups<T>(20 + seed, 0, 50000, seed);
+        auto large = make_sorted_with_dups<T>(30000, 0, 50000, seed + 100);
+        check_intersect<boundcraft::policy::hybrid<16>>(small, large);
+        check_intersect<boundcraft::policy::standard_binary>(large, small);
+    }
+}
+
+TEST(Intersect, DuplicatesFollowSetIntersection)
+{
+    std::vector<int> a{1, 1, 1, 2, 5, 5, 9};
+    std::vector<int> b{1, 1, 2, 2, 2, 5, 7, 9, 9};
+    check_intersect<boundcraft::policy::hybrid<16>>(a, b);
+
+    std::vector<int> large(2000, 4);
+    large.push_back(8);
+    check_intersect<boundcraft::policy::branchless>(std::vector<int>{4, 4, 8, 8}, large);
+}
+
+TEST(Intersect, DescendingListsWithGreater)
+{
+    auto a = make_sorted_with_dups<int>(40, 0, 9000, 1u);
+    auto b = make_sorted_with_dups<int>(9000, 0, 9000, 2u);
+    auto c = make_sorted_with_dups<int>(8000, 0, 9000, 3u);
+    std::reverse(a.begin(), a.end());
+    std::reverse(b.begin(), b.end());
+    std::reverse(c.begin(), c.end());
+
+    check_intersect<boundcraft::policy::hybrid<16>>(a, b, std::greater<>{});
+    check_intersect<boundcraft::policy::hybrid<16>>(c, b, std::greater<>{});
+}
+
+TEST(Intersect, GallopingPolicyContributesItsInnerSearch)
+{
+    using P = boundcraft::policy::galloping<boundcraft::policy::branchless, boundcraft::policy::gallop::start_front>;
+    auto small = make_sorted_with_dups<int>(64, 0, 1 << 20, 4u);
+    auto large = make_sorted_with_dups<int>(1 << 16, 0, 1 << 20, 5u);
+    large.insert(large.end(), small.begin(), small.end());
+    std::sort(large.begin(), large.end());
+    check_intersect<P>(small, large);
+}
+
+// ------------------------------------------------------------
+// k-way intersection / union / merge
+// ------------------------------------------------------------
+
+template <class T, class Comp = std::less<>>
+std::vector<T> fold_std(const std::vector<std::vector<T>>& lists, bool intersection, Comp comp = {})
+{
+    std::vector<T> acc = lists.empty() ? std::vector<T>{} : lists.front();
+    for (std::size_t i = 1; i < lists.size(); ++i)
+    {
+        std::vector<T> next;
+        if (intersection)
+            std::set_intersection(acc.begin(), acc.end(), lists[i].begin(), lists[i].end(), std::back_inserter(next), comp);
+        else
+            std::set_union(acc.begin(), acc.end(), lists[i].begin(), lists[i].end(), std::back_inserter(next), comp);
+        acc = std::move(next);
+    }
+    return acc;
+}
+
+template <class T, class Comp = std::less<>>
+void check_k_way(const std::vector<std::vector<T>>& lists, Comp comp = {})
+{
+    std::vector<std::span<const T>> spans(lists.begin(), lists.end());
+    std::span<const std::span<const T>> view(spans);
+
+    std::size_t total = 0;
+    for (const auto& l : lists) total += l.size();
+    std::vector<T> out(total);
+
+    const std::size_t ni = boundcraft::intersect_k(view, std::span<T>(out), comp);
+    ASSERT_EQ(std::vector<T>(out.begin(), out.begin() + static_cast<std::ptrdiff_t>(ni)), fold_std(lists, true, comp));
+
+    const std::size_t nu = boundcraft::union_k(view, std::span<T>(out), comp);
+    ASSERT_EQ(std::vector<T>(out.begin(), out.begin() + static_cast<std::ptrdiff_t>(nu)), fold_std(lists, false, comp));
+
+    std::vector<T> merged;
+    for (const auto& l : lists) merged.insert(merged.end(), l.begin(), l.end());
+    std::sort(merged.begin(), merged.end(), comp);
+    ASSERT_EQ(boundcraft::merge_k(view, std::span<T>(out), comp), total);
+    ASSERT_EQ(out, merged);
+}
+
+TEST(KWaySetOps, NoListsAndEmptyLists)
+{
+    check_k_way<int>({});
+    check_k_way<int>({{}});
+    check_k_way<int>({{1, 2, 3}, {}, {2, 3}});
+}
+
+TEST(KWaySetOps, SingleAndIdenticalLists)
+{
+    check_k_way<int>({{1, 1, 4, 9}});
+    check_k_way<int>({{1, 2, 2, 3}, {1, 2, 2, 3}, {1, 2, 2, 3}});
+}
+
+TEST(KWaySetOps, DuplicatesUseMinAndMaxCounts)
+{
+    check_k_way<int>({{1, 1, 1, 5, 5, 8}, {1, 1, 5, 5, 5, 8, 8}, {0, 1, 1, 1, 1, 5, 5, 8}});
+}
+
+TEST(KWaySetOps, RandomListsOfMixedSizes)
+{
+    for (std::uint32_t seed = 0; seed < 20; ++seed)
+    {
+        std::vector<std::vector<std::int64_t>> lists;
+        const std::size_t k = 2 + seed % 19;
+        for (std::size_t i = 0; i < k; ++i)
+        {
+            const std::size_t n = (i % 3 == 0) ? 50 : 3000;
+            lists.push_back(make_sorted_with_dups<std::int64_t>(n + seed, 0, 400, seed * 31 + static_cast<std::uint32_t>(i)));
+        }
+        check_k_way(lists);
+    }
+}
+
+TEST(KWaySetOps, DescendingListsWithGreater)
+{
+    std::vector<std::vector<int>> lists;
+    for (std::uint32_t i = 0; i < 6; ++i)
+    {
+        auto v = make_sorted_with_dups<int>(200 * (i + 1), 0, 300, i);
+        std::reverse(v.begin(), v.end());
+        lists.push_back(std::move(v));
+    }
+    check_k_way(lists, std::greater<>{});
+}
+
+} // namespace
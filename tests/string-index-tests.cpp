@@ -0,0 +1,126 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <boundcraft/boundcraft.hpp>
+
+namespace {
+
+// URL-like keys: long shared prefixes, so many keys tie on their first 8 bytes.
+std::vector<std::string> make_sorted_urls(std::size_t n, std::uint32_t seed)
+{
+    static constexpr std::string_view hosts[] = {"https://a.example.com/", "https://api.example.com/v1/",
+                                                 "https://b.example.org/", "http://x.io/", "ftp://y/"};
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<std::size_t> host(0, std::size(hosts) - 1);
+    std::uniform_int_distribution<int> len(0, 12);
+    std::uniform_int_distribution<int> ch('a', 'f');
+
+    std::vector<std::string> v(n);
+    for (auto& s : v)
+    {
+        s = hosts[host(rng)];
+        for (int i = len(rng); i > 0; --i) s.push_back(static_cast<char>(ch(rng)));
+    }
+    std::sort(v.begin(), v.end());
+    return v;
+}
+
+template <class Index>
+void expect_matches_std(const Index& index, const std::vector<std::string>& v, std::string_view q)
+{
+    ASSERT_EQ(index.lower_bound(q) - index.begin(), std::lower_bound(v.begin(), v.end(), q) - v.begin()) << "q=" << q;
+    ASSERT_EQ(index.upper_bound(q) - index.begin(), std::upper_bound(v.begin(), v.end(), q) - v.begin()) << "q=" << q;
+}
+
+template <class Index>
+void expect_probes_match_std(const Index& index, const std::vector<std::string>& v)
+{
+    for (const auto& s : v)
+    {
+        expect_matches_std(index, v, s);
+        expect_matches_std(index, v, s + "a");
+        expect_matches_std(index, v, std::string_view(s).substr(0, s.size() / 2));
+        if (!s.empty())
+        {
+            std::string bumped = s;
+            ++bumped.back();
+            expect_matches_std(index, v, bumped);
+        }
+    }
+    expect_matches_std(index, v, "");
+    expect_matches_std(index, v, "\xff\xff");
+}
+
+TEST(NormalizedPrefix, OrdersLikeStrings)
+{
+    using boundcraft::detail::normalized_prefix;
+    EXPECT_LT(normalized_prefix("abc"), normalized_prefix("abd"));
+    EXPECT_LT(normalized_prefix("ab"), normalized_prefix("abc"));
+    EXPECT_LT(normalized_prefix("zzzzzzz"), normalized_prefix("\x80"));
+    EXPECT_EQ(normalized_prefix("abcdefgh"), normalized_prefix("abcdefghij"));
+    EXPECT_EQ(normalized_prefix(""), 0u);
+}
+
+TEST(StringIndex, EmptyIndex)
+{
+    boundcraft::string_index<> index(std::span<const std::string>{});
+    EXPECT_EQ(index.lower_bound("a"), index.begin());
+    EXPECT_EQ(index.upper_bound("a"), index.begin());
+}
+
+TEST(StringIndex, MatchesStdOnUrls)
+{
+    for (std::size_t n : {1u, 7u, 100u, 3000u})
+    {
+        const auto v = make_sorted_urls(n, static_cast<std::uint32_t>(n));
+        boundcraft::string_index<> index{std::span<const std::string>(v)};
+        expect_probes_match_std(index, v);
+    }
+}
+
+TEST(StringIndex, ShortKeysEmbeddedNulsAndHighBytes)
+{
+    std::vector<std::string> v = {"", "", "a", std::string("a\0", 2), std::string("a\0b", 3), "ab",
+                                  "abcdefgh", "abcdefgh", "abcdefghi", "abcdefgi", "b", "\x7f", "\x80", "\xff\xfe"};
+    std::sort(v.begin(), v.end());
+    boundcraft::string_index<> index{std::span<const std::string>(v)};
+    expect_probes_match_std(index, v);
+}
+
+TEST(StringIndex, SharedHeadIsSkipped)
+{
+    std::vector<std::string> v = make_sorted_urls(1000, 4u);
+    for (auto& s : v) s = "https://www." + s;
+    boundcraft::string_index<> index{std::span<const std::string>(v)};
+
+    EXPECT_EQ(index.common_prefix().substr(0, 12), "https://www.");
+    expect_probes_match_std(index, v);
+    for (std::string_view q : {"", "h", "http", "https://", "https://www", "https://www.", "https://x", "z"})
+    {
+        expect_matches_std(index, v, q);
+    }
+}
+
+TEST(StringIndex, OtherPoliciesAndStringViewKeys)
+{
+    const auto owned = make_sorted_urls(2000, 9u);
+    const std::vector<std::string_view> v(owned.begin(), owned.end());
+
+    boundcraft::string_index<std::string_view, boundcraft::policy::branchless> branchless{std::span<const std::string_view>(v)};
+    boundcraft::string_index<std::string_view, boundcraft::policy::standard_binary> standard{std::span<const std::string_view>(v)};
+    for (const auto& s : owned)
+    {
+        ASSERT_EQ(branchless.lower_bound(s) - branchless.begin(), std::lower_bound(owned.begin(), owned.end(), s) - owned.begin());
+        ASSERT_EQ(standard.upper_bound(s) - standard.begin(), std::upper_bound(owned.begin(), owned.end(), s) - owned.begin());
+    }
+}
+
+} // namespace
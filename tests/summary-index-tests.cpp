@@ -0,0 +1,138 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+#include <boundcraft/boundcraft.hpp>
+
+#include "test-helpers.hpp"
+
+namespace {
+
+using boundcraft_tests::make_sorted_with_dups;
+using boundcraft_tests::expect_matches_std;
+
+// Probes a key, its neighbours in value, and the keys just either side of position pos.
+template <class Index, class T>
+void expect_matches_std_around(const Index& index, std::span<const T> keys, std::size_t pos)
+{
+    for (std::size_t p = pos == 0 ? 0 : pos - 1; p <= pos + 1 && p < keys.size(); ++p)
+    {
+        expect_matches_std(index, keys, keys[p]);
+        expect_matches_std(index, keys, static_cast<T>(keys[p] + 1));
+        if (keys[p] > T(0))
+        {
+            expect_matches_std(index, keys, static_cast<T>(keys[p] - 1));
+        }
+    }
+}
+
+template <class T>
+class SummaryIndexTests : public ::testing::Test {};
+
+using SummaryKeys = ::testing::Types<std::int16_t, std::int32_t, std::uint64_t, double>;
+TYPED_TEST_SUITE(SummaryIndexTests, SummaryKeys);
+
+TYPED_TEST(SummaryIndexTests, QueriesAroundEveryStrideBoundary)
+{
+    using T = TypeParam;
+    auto v = make_sorted_with_dups<T>(20011, 1, 3000, 7u);
+    const std::span<const T> keys(v);
+
+    // A one-key summary (one slice), strides that leave a short last slice, and a summary with
+    // room for every key (stride 1, so slices are empty).
+    for (std::size_t bytes : {sizeof(T), std::size_t{64}, std::size_t{4096}, std::size_t{1} << 20})
+    {
+        boundcraft::summary_index<T> index(keys, bytes);
+        const std::size_t stride = index.stride();
+
+        EXPECT_LE(index.memory_bytes(), bytes);
+        ASSERT_EQ(index.samples().size(), (keys.size() + stride - 1) / stride);
+        for (std::size_t j = 0; j < index.samples().size(); ++j)
+        {
+            expect_matches_std_around(index, keys, j * stride);
+        }
+        expect_matches_std_around(index, keys, keys.size() - 1);
+        expect_matches_std(index, keys, T(0));
+        expect_matches_std(index, keys, T(3001));
+    }
+}
+
+TEST(SummaryIndex, EmptyIndex)
+{
+    boundcraft::summary_index<std::int32_t> index(std::span<const std::int32_t>{});
+    EXPECT_TRUE(index.samples().empty());
+    EXPECT_EQ(index.lower_bound(1), index.begin());
+    EXPECT_EQ(index.upper_bound(1), index.begin());
+}
+
+TEST(SummaryIndex, FewerKeysThanTheSummaryHolds)
+{
+    std::vector<std::int32_t> v{2, 4, 4, 6};
+    boundcraft::summary_index<std::int32_t> index{std::span<const std::int32_t>(v)};
+
+    EXPECT_EQ(index.stride(), 1u);
+    EXPECT_EQ(index.samples().size(), v.size());
+    for (std::int32_t q = 0; q <= 7; ++q)
+    {
+        expect_matches_std(index, std::span<const std::int32_t>(v), q);
+    }
+}
+
+TEST(SummaryIndex, SamplesEveryStrideKeyInCacheAlignedStorage)
+{
+    auto v = make_sorted_with_dups<std::int32_t>(1 << 16, 0, 1 << 20, 3u);
+    boundcraft::summary_index<std::int32_t> index(std::span<const std::int32_t>(v), 1024);
+
+    EXPECT_EQ(index.stride(), v.size() / (1024 / sizeof(std::int32_t)));
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(index.samples().data()) % boundcraft::detail::cache_line_bytes, 0u);
+    for (std::size_t i = 0; i < index.samples().size(); ++i)
+    {
+        ASSERT_EQ(index.samples()[i], v[i * index.stride()]);
+    }
+}
+
+TEST(SummaryIndex, RandomQueriesWithOtherSlicePolicies)
+{
+    auto v = make_sorted_with_dups<std::int32_t>(1 << 16, 0, 1 << 20, 3u);
+    const std::span<const std::int32_t> keys(v);
+    boundcraft::summary_index<std::int32_t, boundcraft::policy::standard_binary> a(keys, 512);
+    boundcraft::summary_index<std::int32_t, boundcraft::policy::prefetch_binary<1>> b(keys, 4096);
+    boundcraft::summary_index<std::int32_t, boundcraft::policy::hybrid_auto> c(keys, 3000);
+
+    std::mt19937 rng(4u);
+    std::uniform_int_distribution<std::int32_t> qdist(-5, (1 << 20) + 5);
+    for (int i = 0; i < 20000; ++i)
+    {
+        const std::int32_t q = qdist(rng);
+        expect_matches_std(a, keys, q);
+        expect_matches_std(b, keys, q);
+        expect_matches_std(c, keys, q);
+    }
+}
+
+TEST(SummaryIndex, LongDuplicateRunsAcrossSamples)
+{
+    std::vector<std::int64_t> v(3000, 5);
+    v.insert(v.begin(), 100, 1);
+    v.insert(v.end(), 101, 9);
+    boundcraft::summary_index<std::int64_t> index(std::span<const std::int64_t>(v), 128);
+
+    for (std::int64_t q : {0, 1, 2, 5, 6, 9, 10})
+    {
+        expect_matches_std(index, std::span<const std::int64_t>(v), q);
+    }
+}
+
+TEST(SummaryIndex, RejectsSummariesSmallerThanAKey)
+{
+    std::vector<std::int64_t> v{1, 2, 3};
+    EXPECT_THROW(boundcraft::summary_index<std::int64_t>(std::span<const std::int64_t>(v), 4), std::invalid_argument);
+}
+
+} // namespace
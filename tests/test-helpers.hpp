@@ -0,0 +1,55 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+// Helpers shared by the test files: sorted inputs with duplicates, and a check of an index's
+// lower_bound/upper_bound against std::lower_bound/std::upper_bound on the same keys.
+
+namespace boundcraft_tests {
+
+// n keys drawn uniformly from [minv, maxv] and sorted; a narrow range gives long runs of equal keys.
+template <class T = int, class Bound = int>
+std::vector<T> make_sorted_with_dups(std::size_t n, Bound minv, Bound maxv, std::mt19937& rng)
+{
+    std::uniform_int_distribution<Bound> dist(minv, maxv);
+    std::vector<T> v(n);
+    for (auto& x : v) x = static_cast<T>(dist(rng));
+    std::sort(v.begin(), v.end());
+    return v;
+}
+
+template <class T = int, class Bound = int>
+std::vector<T> make_sorted_with_dups(std::size_t n, Bound minv, Bound maxv, std::uint32_t seed)
+{
+    std::mt19937 rng(seed);
+    return make_sorted_with_dups<T>(n, minv, maxv, rng);
+}
+
+// Indexes return either a position or a pointer into the keys; compare both as positions.
+template <class Index, class Result>
+std::ptrdiff_t position_of(const Index& index, Result result)
+{
+    if constexpr (std::is_integral_v<Result>)
+        return static_cast<std::ptrdiff_t>(result);
+    else
+        return result - index.begin();
+}
+
+template <class Index, class Keys, class V>
+void expect_matches_std(const Index& index, const Keys& v, const V& q)
+{
+    const auto first = std::begin(v);
+    const auto last = std::end(v);
+    ASSERT_EQ(position_of(index, index.lower_bound(q)), std::lower_bound(first, last, q) - first) << "q=" << q;
+    ASSERT_EQ(position_of(index, index.upper_bound(q)), std::upper_bound(first, last, q) - first) << "q=" << q;
+}
+
+} // namespace boundcraft_tests
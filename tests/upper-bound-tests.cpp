@@ -5,13 +5,17 @@
 #include <cstddef>
 #include <cstdint>
 #include <functional>
+#include <limits>
 #include <random>
 #include <span>
 #include <type_traits>
 #include <vector>
 
+#include <boundcraft/adaptive.hpp>
 #include <boundcraft/searcher.hpp>
 
+#include "test-helpers.hpp"
+
 namespace {
 
 struct Elem {
@@ -46,7 +50,23 @@ template <class Policy>
 using Searcher = boundcraft::searcher<Policy>;
 
 // EDIT THIS LIST:
-using PoliciesUnderTest = ::testing::Types<boundcraft::policy::standard_binary>;
+using PoliciesUnderTest = ::testing::Types<
+    boundcraft::policy::standard_binary,
+    boundcraft::policy::branchless,
+    boundcraft::policy::prefetch_binary<1>,
+    boundcraft::policy::prefetch_binary<2>,
+    boundcraft::policy::hybrid<16>,
+    boundcraft::policy::hybrid<64>,
+    boundcraft::policy::hybrid_auto,
+    boundcraft::policy::interpolation<>,
+    boundcraft::policy::interpolation<2, 1>,
+    boundcraft::policy::adaptive,
+    boundcraft::policy::galloping<boundcraft::policy::standard_binary, boundcraft::policy::gallop::start_front>,
+    boundcraft::policy::galloping<boundcraft::policy::hybrid<16>, boundcraft::policy::gallop::start_back>,
+    boundcraft::policy::galloping<boundcraft::policy::prefetch_binary<2>, boundcraft::policy::gallop::start_front>,
+    boundcraft::policy::galloping<boundcraft::policy::branchless, boundcraft::policy::gallop::start_middle>,
+    boundcraft::policy::galloping<boundcraft::policy::branchless, boundcraft::policy::gallop::start_last_searched<3>>,
+    boundcraft::policy::galloping<boundcraft::policy::interpolation<>, boundcraft::policy::gallop::start_middle>>;
 
 template <class Policy>
 class UpperBoundTests : public ::testing::Test {
@@ -58,14 +78,7 @@ public:
 TYPED_TEST_SUITE(UpperBoundTests, PoliciesUnderTest);
 
 static std::vector<int> make_sorted_with_dupes(std::size_t n, int distinct = 50, std::uint32_t seed = 123) {
-    std::mt19937 rng(seed);
-    std::uniform_int_distribution<int> dist(0, distinct - 1);
-
-    std::vector<int> v;
-    v.reserve(n);
-    for (std::size_t i = 0; i < n; ++i) v.push_back(dist(rng));
-    std::sort(v.begin(), v.end());
-    return v;
+    return boundcraft_tests::make_sorted_with_dups(n, 0, distinct - 1, seed);
 }
 
 static std::vector<Elem> make_sorted_elems(std::size_t n, int distinct = 50, std::uint32_t seed = 456) {
@@ -208,4 +221,74 @@ TYPED_TEST(UpperBoundTests, Randomized_PropertyTest_AgreesWithStd) {
     }
 }
 
+// ------------------------------------------------------------
+// Arithmetic keys (SIMD tail scan of the hybrid policy)
+// ------------------------------------------------------------
+template <class T>
+class UpperBoundArithmeticKeys : public ::testing::Test {};
+
+using ArithmeticKeys = ::testing::Types<std::int32_t, std::uint32_t, std::int64_t, std::uint64_t, float, double>;
+TYPED_TEST_SUITE(UpperBoundArithmeticKeys, ArithmeticKeys);
+
+TYPED_TEST(UpperBoundArithmeticKeys, HybridWindowMatchesStd) {
+    using T = TypeParam;
+    Searcher<boundcraft::policy::hybrid<64>> s;
+
+    for (std::size_t n : {0u, 1u, 5u, 8u, 17u, 64u, 65u, 500u}) {
+        std::vector<T> asc;
+        for (int x : make_sorted_with_dupes(n, 40, static_cast<std::uint32_t>(n))) asc.push_back(static_cast<T>(x));
+        std::vector<T> desc(asc.rbegin(), asc.rend());
+
+        for (int q = -1; q <= 41; ++q) {
+            const T key = static_cast<T>(q);
+
+            auto it1 = s.upper_bound(asc.data(), asc.data() + asc.size(), key);
+            auto it2 = std::upper_bound(asc.begin(), asc.end(), key);
+            EXPECT_EQ(it1 - asc.data(), std::distance(asc.begin(), it2));
+
+            auto it3 = s.upper_bound(desc.data(), desc.data() + desc.size(), key, std::greater<>{});
+            auto it4 = std::upper_bound(desc.begin(), desc.end(), key, std::greater<>{});
+            EXPECT_EQ(it3 - desc.data(), std::distance(desc.begin(), it4));
+        }
+    }
+}
+
+TYPED_TEST(UpperBoundArithmeticKeys, HybridWindowHandlesExtremeValues) {
+    using T = TypeParam;
+    using lim = std::numeric_limits<T>;
+    Searcher<boundcraft::policy::hybrid<64>> s;
+
+    std::vector<T> v{lim::lowest(), T(0), T(1), T(1), T(lim::max() / 2), T(lim::max() / 2 + 1), lim::max()};
+
+    for (T q : v) {
+        auto it1 = s.upper_bound(v.data(), v.data() + v.size(), q);
+        auto it2 = std::upper_bound(v.begin(), v.end(), q);
+        EXPECT_EQ(it1 - v.data(), std::distance(v.begin(), it2));
+    }
+}
+
+TYPED_TEST(UpperBoundArithmeticKeys, InterpolationSurvivesSkewedKeys) {
+    using T = TypeParam;
+    Searcher<boundcraft::policy::interpolation<2, 1>> s;
+
+    std::vector<T> v;
+    for (std::uint64_t x = 1; v.size() < 40 && x <= static_cast<std::uint64_t>(std::numeric_limits<T>::max()) / 3; x *= 3) {
+        v.push_back(static_cast<T>(x));
+        v.push_back(static_cast<T>(x));
+    }
+    std::vector<T> desc(v.rbegin(), v.rend());
+
+    for (std::size_t i = 0; i < v.size(); ++i) {
+        for (T q : {v[i], static_cast<T>(v[i] - 1), static_cast<T>(v[i] + 1)}) {
+            auto it1 = s.upper_bound(v.data(), v.data() + v.size(), q);
+            auto it2 = std::upper_bound(v.begin(), v.end(), q);
+            EXPECT_EQ(it1 - v.data(), std::distance(v.begin(), it2));
+
+            auto it3 = s.upper_bound(desc.data(), desc.data() + desc.size(), q, std::greater<>{});
+            auto it4 = std::upper_bound(desc.begin(), desc.end(), q, std::greater<>{});
+            EXPECT_EQ(it3 - desc.data(), std::distance(desc.begin(), it4));
+        }
+    }
+}
+
 } // namespace